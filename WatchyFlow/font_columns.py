@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+#
+# Generates the column data Framebuffer needs to draw a GFX font rotated by
+# 90 or 270 degrees without going pixel by pixel:
+#
+#   ./font_columns.py src/Fonts/Seven_Segment10pt7b.h \
+#       > src/Fonts/Seven_Segment10pt7b_columns.h
+#
+# Every glyph is stored one column after the other, left to right. A column
+# is the glyph's pixels from top to bottom, most significant bit first,
+# padded to whole bytes.
+
+import re
+import sys
+
+
+def parse(source):
+    name = re.search(r"const GFXfont\s+(\w+)\s+PROGMEM", source).group(1)
+    bitmaps = re.search(r"Bitmaps\[\]\s+PROGMEM\s*=\s*{(.*?)}", source, re.S)
+    bitmap = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", bitmaps.group(1))]
+    glyphs = re.search(r"Glyphs\[\]\s+PROGMEM\s*=\s*{(.*)};", source, re.S)
+    glyph = [
+        tuple(int(v) for v in g)
+        for g in re.findall(
+            r"{\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(-?\d+),\s*(-?\d+)\s*}",
+            glyphs.group(1),
+        )
+    ]
+    return name, bitmap, glyph
+
+
+def columns(bitmap, offset, width, height):
+    def bit(i):
+        return (bitmap[offset + i // 8] >> (7 - i % 8)) & 1
+
+    out = []
+    for x in range(width):
+        column = [0] * ((height + 7) // 8)
+        for y in range(height):
+            if bit(y * width + x):
+                column[y // 8] |= 0x80 >> (y % 8)
+        out.extend(column)
+    return out
+
+
+def rows(values, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(values[i : i + per_line]))
+    return ",\n".join(lines)
+
+
+def main():
+    path = sys.argv[1]
+    with open(path) as f:
+        name, bitmap, glyphs = parse(f.read())
+
+    data = []
+    offsets = []
+    for offset, width, height, _, _, _ in glyphs:
+        offsets.append(len(data))
+        data.extend(columns(bitmap, offset, width, height))
+
+    print("#pragma once")
+    print()
+    print("// generated by font_columns.py from %s, do not edit." % path.split("/")[-1])
+    print("// pass to Display::addFontColumns together with %s." % name)
+    print()
+    print('#include "../Watchy/Framebuffer.h"')
+    print()
+    print("const uint8_t %sColumnBitmaps[] PROGMEM = {" % name)
+    print(rows(["0x%02X" % v for v in data], 12) + "};")
+    print()
+    print("const uint16_t %sColumnOffsets[] PROGMEM = {" % name)
+    print(rows(["%d" % v for v in offsets], 10) + "};")
+    print()
+    print("const FontColumns %sColumns PROGMEM = {" % name)
+    print("    %sColumnBitmaps, %sColumnOffsets, %d};" % (name, name, len(offsets)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,130 @@
+// replays timelines of which buttons are held through ButtonQueue and checks
+// the presses that come out. buttons are bits: 8 is down, 4 up, 1 menu.
+
+#include "Test.h"
+#include "../src/Watchy/ButtonQueue.h"
+
+int testFailures = 0;
+
+typedef struct Sample {
+  uint32_t millis;
+  uint8_t held;
+} Sample;
+
+static void replay(ButtonQueue *queue, const Sample *samples, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    queue->sample(samples[i].held, samples[i].millis);
+  }
+}
+
+#define REPLAY(queue, samples)                                                 \
+  replay(queue, samples, sizeof(samples) / sizeof(samples[0]))
+
+static bool next(ButtonQueue *queue, uint8_t button, uint8_t count) {
+  uint8_t b, c;
+  return queue->pop(&b, &c) && b == button && c == count;
+}
+
+static void heldWakeButton() {
+  ButtonQueue queue;
+  queue.start(8, 0);
+  Sample samples[] = {{5, 8}, {50, 0}};
+  REPLAY(&queue, samples);
+  CHECK(queue.empty());
+}
+
+static void bounceOnPress() {
+  ButtonQueue queue;
+  queue.start(0, 0);
+  Sample samples[] = {{100, 8}, {105, 0}, {108, 8}, {200, 0},
+                      {300, 8}, {380, 0}, {500, 8}, {600, 0}};
+  REPLAY(&queue, samples);
+  CHECK(next(&queue, 3, 3));
+  CHECK(queue.empty());
+}
+
+static void bounceOnRelease() {
+  ButtonQueue queue;
+  queue.start(0, 0);
+  // held for 100ms, then the contact chatters as it opens.
+  Sample samples[] = {{1000, 8}, {1100, 0}, {1103, 8}, {1106, 0}};
+  REPLAY(&queue, samples);
+  CHECK(next(&queue, 3, 1));
+  CHECK(queue.empty());
+}
+
+static void pressAfterRelease() {
+  ButtonQueue queue;
+  queue.start(0, 0);
+  // 25ms after a release is still bounce, 40ms after is a press.
+  Sample samples[] = {{1000, 8}, {1100, 0}, {1125, 8}, {1200, 0},
+                      {1240, 8}, {1300, 0}};
+  REPLAY(&queue, samples);
+  CHECK(next(&queue, 3, 2));
+  CHECK(queue.empty());
+}
+
+static void coalescing() {
+  ButtonQueue queue;
+  queue.start(0, 0);
+  Sample samples[] = {{1000, 8}, {1100, 0}, {1200, 8}, {1300, 0},
+                      {1400, 4}, {1500, 0}, {1600, 8}, {1700, 0}};
+  REPLAY(&queue, samples);
+  CHECK(next(&queue, 3, 2));
+  CHECK(next(&queue, 2, 1));
+  CHECK(next(&queue, 3, 1));
+  CHECK(queue.empty());
+}
+
+static void simultaneous() {
+  ButtonQueue queue;
+  queue.start(0, 0);
+  Sample samples[] = {{1000, 9}, {1100, 0}};
+  REPLAY(&queue, samples);
+  uint8_t b, c;
+  CHECK(queue.pop(&b, &c) && c == 1);
+  CHECK(queue.pop(&b, &c) && c == 1);
+  CHECK(queue.empty());
+}
+
+static void overflow() {
+  ButtonQueue queue;
+  queue.start(0, 0);
+  uint32_t millis = 2000;
+  for (int i = 0; i < ButtonQueue::SIZE + 2; i++) {
+    queue.sample(i % 2 ? 4 : 8, millis);
+    queue.sample(0, millis + 50);
+    millis += 100;
+  }
+  int presses = 0;
+  uint8_t b, c;
+  while (queue.pop(&b, &c)) {
+    presses++;
+  }
+  CHECK(presses == ButtonQueue::SIZE);
+}
+
+static void millisWraparound() {
+  ButtonQueue queue;
+  queue.start(0, 0xfffffff0);
+  queue.sample(1, 0x20);
+  CHECK(next(&queue, 0, 1));
+  // and a bounce across the wrap is still a bounce
+  queue.start(0, 0xffffffd0);
+  Sample samples[] = {{0xfffffff8, 1}, {0x10, 0}, {0x14, 1}, {0x60, 0}};
+  REPLAY(&queue, samples);
+  CHECK(next(&queue, 0, 1));
+  CHECK(queue.empty());
+}
+
+int main() {
+  heldWakeButton();
+  bounceOnPress();
+  bounceOnRelease();
+  pressAfterRelease();
+  coalescing();
+  simultaneous();
+  overflow();
+  millisWraparound();
+  return testResult("ButtonQueueTest");
+}
@@ -0,0 +1,209 @@
+// checks that wakes which leave the panel alone never talk to it, and what
+// the others send. each wake gets a new Display over the RTC memory the last
+// one left, like a boot after deep sleep, and the fake panel records
+// everything sent over SPI.
+
+#include "Test.h"
+#include "HostWatchy.h"
+#include "Panel.h"
+#include "../src/Apps/Calendar/CalendarFace.h"
+#include "../src/Elements/Notice.h"
+#include "../src/Watchy/Framebuffer.h"
+#include <string>
+
+int testFailures = 0;
+
+// what an app would draw, with a box that moves to change the frame.
+static void draw(Display *display, int16_t boxX) {
+  display->fillScreen(GxEPD_WHITE);
+  display->fillRect(boxX, 40, 60, 30, GxEPD_BLACK);
+  display->drawFastHLine(0, 150, 200, GxEPD_BLACK);
+  display->setTextColor(GxEPD_BLACK);
+  display->setCursor(10, 170);
+  display->print("12:34");
+}
+
+// the image writes, with their sizes, updates and deep sleeps sent to the
+// panel, leaving out the setup around them.
+static std::string trace() {
+  std::string out;
+  for (size_t i = 0; i < panel.commands.size(); i++) {
+    const Panel::Command &c = panel.commands[i];
+    char item[16];
+    if (c.command == 0x24) {
+      snprintf(item, sizeof(item), "24:%u", unsigned(c.data.size()));
+    } else if (c.command == 0x22 || c.command == 0x10) {
+      snprintf(item, sizeof(item), "%02x", c.command);
+    } else {
+      continue;
+    }
+    out += out.empty() ? "" : " ";
+    out += item;
+  }
+  return out;
+}
+
+static bool showing(const Display &display) {
+  return memcmp(panel.shown, display.buffer(), Panel::BYTES) == 0;
+}
+
+static void firstBoot() {
+  panel.powerCycle();
+  Display display;
+  display.powerOnWhileDrawing(true);
+  draw(&display, 20);
+  display.display(false);
+  CHECK(panel.resets == 1);
+  CHECK(panel.count(0x24) > 0);
+  CHECK(showing(display));
+  display.hibernate();
+  CHECK(panel.asleep);
+}
+
+static void unchangedClockWake(int16_t boxX) {
+  panel.clear();
+  Display display;
+  display.powerOnWhileDrawing(false);
+  draw(&display, boxX);
+  display.display(true);
+  display.hibernate();
+  CHECK(panel.commands.empty());
+  CHECK(panel.resets == 0);
+  CHECK(panel.asleep);
+}
+
+static void changedClockWake() {
+  panel.clear();
+  Display display;
+  display.powerOnWhileDrawing(false);
+  draw(&display, 100);
+  display.display(true);
+  CHECK(panel.resets == 1);
+  CHECK(panel.count(0x10) == 0);
+  CHECK(!panel.updates.empty());
+  CHECK(showing(display));
+  display.hibernate();
+  CHECK(panel.count(0x10) == 1);
+  CHECK(panel.asleep);
+}
+
+static void drawWhileRefreshing() {
+  // the next frame drawn into the buffer while the panel still updates must
+  // not reach the controller as the frame it just showed.
+  panel.clear();
+  Display display;
+  display.epd2.asyncRefresh = true;
+  display.powerOnWhileDrawing(false);
+  draw(&display, 60);
+  display.display(true);
+  uint8_t sent[Panel::BYTES];
+  memcpy(sent, display.buffer(), sizeof(sent));
+  draw(&display, 140);
+  display.hibernate();
+  CHECK(memcmp(panel.shown, sent, sizeof(sent)) == 0);
+  CHECK(memcmp(panel.ram, sent, sizeof(sent)) == 0);
+}
+
+static CalendarSettings calendarSettings() {
+  CalendarSettings settings;
+  settings.metric = true;
+  return settings;
+}
+
+// a calendar wake drawn the way Watchy::wakeup does, with the notice a fetch
+// draws over the frame when notice is set.
+static void noticeWake(CalendarFace *calendar, HostWatchy *watchy,
+                       bool notice) {
+  bool reset = watchy->wakeupReason() == WAKEUP_RESET;
+  Display display;
+  display.epd2.asyncRefresh = true;
+  display.powerOnWhileDrawing(watchy->wakeupReason() != WAKEUP_CLOCK);
+  display.drawWholeFrames(notice);
+  if (reset) {
+    calendar->reset(watchy);
+  }
+  calendar->show(watchy, &display, !reset);
+  if (notice) {
+    showNotice(&display, "Connecting...");
+  }
+  display.hibernate();
+}
+
+// a wake that fetches, drawn the way Watchy::wakeup does: the frame, the
+// notices when the wake shows them, and the frame again after the fetch.
+static void fetchWake(CalendarFace *calendar, HostWatchy *watchy) {
+  bool notices = showsNotices(watchy->wakeupReason());
+  Display display;
+  display.epd2.asyncRefresh = true;
+  display.powerOnWhileDrawing(watchy->wakeupReason() != WAKEUP_CLOCK);
+  display.drawWholeFrames(notices);
+  calendar->show(watchy, &display, true);
+  if (notices) {
+    showNotice(&display, "Connecting...");
+    showNotice(&display, "Loading...   ");
+  }
+  calendar->show(watchy, &display, true);
+  display.hibernate();
+}
+
+static void noticeOverChangedFrame() {
+  CalendarFace calendar(calendarSettings());
+
+  // the frame and the notice drawn from scratch
+  panel.powerCycle();
+  HostWatchy watchy(hostTime(9, 27, 0), WAKEUP_RESET);
+  noticeWake(&calendar, &watchy, true);
+  uint8_t whole[Panel::BYTES];
+  memcpy(whole, panel.shown, sizeof(whole));
+
+  // a minute earlier, then a clock wake that changes the time and fetches.
+  // the notice must not blank the widgets that kept their tiles.
+  panel.powerCycle();
+  watchy.set(hostTime(9, 26, 53), WAKEUP_RESET);
+  noticeWake(&calendar, &watchy, false);
+  watchy.set(hostTime(9, 27, 0), WAKEUP_CLOCK);
+  noticeWake(&calendar, &watchy, true);
+  CHECK(memcmp(panel.shown, whole, sizeof(whole)) == 0);
+}
+
+static void fetchWakes() {
+  CalendarFace calendar(calendarSettings());
+  panel.powerCycle();
+  HostWatchy watchy(hostTime(9, 27, 0), WAKEUP_RESET);
+  noticeWake(&calendar, &watchy, false);
+  uint8_t frame[Panel::BYTES];
+  memcpy(frame, panel.shown, sizeof(frame));
+
+  // a clock wake whose fetch found nothing new
+  panel.clear();
+  watchy.set(hostTime(9, 27, 0), WAKEUP_CLOCK);
+  fetchWake(&calendar, &watchy);
+  CHECK(panel.commands.empty());
+  CHECK(panel.resets == 0);
+
+  // a button wake shows both notices, then puts the frame back
+  panel.clear();
+  watchy.set(hostTime(9, 27, 0), WAKEUP_BUTTON);
+  fetchWake(&calendar, &watchy);
+  // the first update only powers the panel on. the writes after each
+  // refresh put the frame just shown into 0x24 again.
+  CHECK(trace() == "22 "
+                   "24:300 22 24:300 "
+                   "24:100 22 24:100 "
+                   "24:300 22 24:300 10");
+  CHECK(panel.resets == 1);
+  CHECK(panel.updates.size() == 4);
+  CHECK(memcmp(panel.shown, frame, sizeof(frame)) == 0);
+}
+
+int main() {
+  firstBoot();
+  unchangedClockWake(20);
+  changedClockWake();
+  unchangedClockWake(100);
+  drawWhileRefreshing();
+  unchangedClockWake(60);
+  noticeOverChangedFrame();
+  fetchWakes();
+  return testResult("DisplayWakeTest");
+}
@@ -0,0 +1,84 @@
+#include "HostWatchy.h"
+
+// the parts of Watchy.cpp the apps call, without the hardware behind them.
+
+static time_t timezoneOffset_;
+static uint32_t steps_ = 4321;
+
+WatchySettings HostWatchy::settings() {
+  WatchySettings settings              = {};
+  settings.networkFetchIntervalSeconds = 60 * 60;
+  settings.networkFetchTries           = 3;
+  settings.buttonConfig                = BUTTONS_SELECT_BACK_LEFT;
+  settings.fullVoltage                 = 4.2;
+  settings.emptyVoltage                = 3.2;
+  return settings;
+}
+
+tmElements_t hostTime(uint8_t hour, uint8_t minute, uint8_t second) {
+  tmElements_t tm;
+  tm.Year   = CalendarYrToTm(2026);
+  tm.Month  = 3;
+  tm.Day    = 14;
+  tm.Hour   = hour;
+  tm.Minute = minute;
+  tm.Second = second;
+  breakTime(makeTime(tm), tm); // fills in Wday
+  return tm;
+}
+
+void Watchy::vibrate(uint8_t intervalMs, uint8_t length) {}
+
+float Watchy::battVoltage() { return 3.9; }
+
+int Watchy::battPercent() { return 70; }
+
+bool Watchy::usbPluggedIn() { return false; }
+
+uint32_t Watchy::buttonLatencyMicros(bool interactive) { return 0; }
+
+void Watchy::setTimezoneOffset(time_t offset) { timezoneOffset_ = offset; }
+
+time_t Watchy::toUnixTime(const tmElements_t &local) {
+  return makeTime(local) - timezoneOffset_;
+}
+
+tmElements_t Watchy::toLocalTime(time_t unix) {
+  tmElements_t local;
+  breakTime(unix + timezoneOffset_, local);
+  return local;
+}
+
+bool Watchy::quietHours() {
+  return localtime().Hour >= 22 || localtime().Hour < 6;
+}
+
+void Watchy::triggerNetworkFetch() {}
+
+const WiFiStats &Watchy::wifiStats() {
+  static WiFiStats stats;
+  return stats;
+}
+
+time_t Watchy::lastSuccessfulNetworkFetch() { return 0; }
+
+uint32_t Watchy::stepCounter() { return steps_; }
+
+void Watchy::resetStepCounter() { steps_ = 0; }
+
+uint8_t Watchy::temperature() { return 24; }
+
+bool Watchy::accel(AccelData &acc) {
+  acc.x = 0;
+  acc.y = 0;
+  acc.z = -1000;
+  return true;
+}
+
+uint8_t Watchy::direction() { return 0; }
+
+void Watchy::reset(const tmElements_t &currentTime, WakeupReason wakeup) {
+  localtime_ = currentTime;
+  unixtime_  = toUnixTime(currentTime);
+  wakeup_    = wakeup;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "../src/Watchy/Watchy.h"
+
+// a Watchy at a fixed time, with the battery, sensors and network reading
+// fixed values, for drawing apps on the host.
+class HostWatchy : public Watchy {
+public:
+  explicit HostWatchy(const tmElements_t &time,
+                      WakeupReason wakeup = WAKEUP_CLOCK)
+      : Watchy(time, wakeup, settings()) {}
+
+  // moves the clock, as a later wake would see it.
+  void set(const tmElements_t &time, WakeupReason wakeup = WAKEUP_CLOCK) {
+    reset(time, wakeup);
+  }
+
+  static WatchySettings settings();
+};
+
+// 2026-03-14 09:26:53, a saturday.
+tmElements_t hostTime(uint8_t hour = 9, uint8_t minute = 26,
+                      uint8_t second = 53);
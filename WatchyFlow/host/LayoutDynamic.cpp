@@ -0,0 +1,41 @@
+#include "Layouts.h"
+#include "../src/Layout/Layout.h"
+#include "../src/Elements/Buttons.h"
+#include "../src/Fonts/DSEG7_Classic_Regular_39.h"
+#include "../src/Fonts/Seven_Segment10pt7b.h"
+#include <Fonts/FreeSans9pt7b.h>
+
+// as StopwatchApp::show drew it before Static layouts
+void stopwatchDynamic(Watchy *watchy, Display *display, const String &split,
+                      const String &time, bool running) {
+  uint16_t w, h;
+  LayoutButtonLabels(
+      watchy, "Back", running ? "Stop" : "Start", "Split",
+      running ? "Refresh" : "Reset", NULL, GxEPD_BLACK, false,
+      LayoutVCenter(LayoutRows({
+          LayoutEntry(LayoutHCenter(
+              LayoutText(split, &Seven_Segment10pt7b, GxEPD_BLACK))),
+          LayoutEntry(LayoutSpacer(5)),
+          LayoutEntry(LayoutHCenter(
+              LayoutText(time, &DSEG7_Classic_Regular_39, GxEPD_BLACK))),
+          LayoutEntry(LayoutSpacer(5)),
+          LayoutEntry(
+              LayoutHCenter(LayoutText(running ? "Running..." : "Stopped",
+                                       &FreeSans9pt7b, GxEPD_BLACK))),
+      })))
+      .draw(display, 0, 0, display->width(), display->height(), &w, &h);
+}
+
+// as Watchy::drawNotice drew it before Static layouts
+void noticeDynamic(Display *display, const char *msg) {
+  ArenaScope frame(globalArena);
+  LayoutBackground notice(
+      LayoutBorder(LayoutPad(LayoutText(msg, NULL, GxEPD_BLACK), 3, 3, 3, 3),
+                   true, true, true, true, GxEPD_BLACK),
+      GxEPD_WHITE);
+
+  uint16_t w, h;
+  notice.size(display, 0, 0, &w, &h);
+  notice.draw(display, display->width() - w - 3, display->height() - h - 3, 0,
+              0, &w, &h);
+}
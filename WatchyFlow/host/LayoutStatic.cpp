@@ -0,0 +1,40 @@
+#include "Layouts.h"
+#include "../src/Layout/Static.h"
+#include "../src/Elements/Buttons.h"
+#include "../src/Fonts/DSEG7_Classic_Regular_39.h"
+#include "../src/Fonts/Seven_Segment10pt7b.h"
+#include <Fonts/FreeSans9pt7b.h>
+
+// as StopwatchApp::show draws it
+void stopwatchStatic(Watchy *watchy, Display *display, const String &split,
+                     const String &time, bool running) {
+  auto face = Static::vcenter(Static::rows(
+      Static::hcenter(
+          Static::text(split.c_str(), &Seven_Segment10pt7b, GxEPD_BLACK)),
+      Static::spacer<5>(),
+      Static::hcenter(
+          Static::text(time.c_str(), &DSEG7_Classic_Regular_39, GxEPD_BLACK)),
+      Static::spacer<5>(),
+      Static::hcenter(Static::text(running ? "Running..." : "Stopped",
+                                   &FreeSans9pt7b, GxEPD_BLACK))));
+
+  uint16_t w, h;
+  LayoutButtonLabels(watchy, "Back", running ? "Stop" : "Start", "Split",
+                     running ? "Refresh" : "Reset", NULL, GxEPD_BLACK, false,
+                     layoutStatic(face))
+      .draw(display, 0, 0, display->width(), display->height(), &w, &h);
+}
+
+// as showNotice draws it
+void noticeStatic(Display *display, const char *msg) {
+  auto notice = Static::background(
+      Static::border<true, true, true, true>(
+          Static::pad<3, 3, 3, 3>(Static::text(msg, NULL, GxEPD_BLACK)),
+          GxEPD_BLACK),
+      GxEPD_WHITE);
+
+  uint16_t w, h;
+  notice.size(display, 0, 0, &w, &h);
+  notice.draw(display, display->width() - w - 3, display->height() - h - 3, 0,
+              0, &w, &h);
+}
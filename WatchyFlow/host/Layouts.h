@@ -0,0 +1,15 @@
+#pragma once
+
+// the stopwatch face and the notice box twice: as the Static layouts the
+// apps draw them with, and as the LayoutElement trees those replaced. each
+// kind is in its own file, so make layout-size can compare their code.
+
+#include "../src/Watchy/Watchy.h"
+
+void stopwatchStatic(Watchy *watchy, Display *display, const String &split,
+                     const String &time, bool running);
+void stopwatchDynamic(Watchy *watchy, Display *display, const String &split,
+                      const String &time, bool running);
+
+void noticeStatic(Display *display, const char *msg);
+void noticeDynamic(Display *display, const char *msg);
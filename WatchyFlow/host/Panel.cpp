@@ -0,0 +1,185 @@
+#include "Panel.h"
+
+Panel panel;
+
+// busy times measured on a GDEH0154D67, see the comments in Display.h
+static uint32_t busyMicros(uint8_t sequence) {
+  switch (sequence) {
+  case 0xf8: // clock and analog on
+    return 95583;
+  case 0x83: // analog and clock off
+    return 140621;
+  case 0xf4: // full update
+    return 2509602;
+  case 0xfc: // partial update
+    return 457282;
+  case 0xcc: // partial update with the fast lut already loaded
+    return 300000;
+  default:
+    return 0;
+  }
+}
+
+Panel::Panel() { powerCycle(); }
+
+void Panel::attach(int16_t cs, int16_t dc, int16_t rst, int16_t busy) {
+  dc_            = dc;
+  rst_           = rst;
+  busy_          = busy;
+  hostPinChanged = pinChanged;
+  hostPinLevel   = pinLevel;
+}
+
+void Panel::clear() {
+  commands.clear();
+  updates.clear();
+  resets = 0;
+}
+
+void Panel::powerCycle() {
+  clear();
+  asleep     = false;
+  busyUntil_ = 0;
+  sequence_  = 0;
+  memset(ram, 0xff, sizeof(ram));
+  memset(previous, 0xff, sizeof(previous));
+  memset(shown, 0xff, sizeof(shown));
+}
+
+void Panel::pinChanged(uint8_t pin) {
+  if (pin != panel.rst_) {
+    return;
+  }
+  uint8_t level = digitalRead(pin);
+  // a reset pulse is low then high again, and it is the only way out of
+  // deep sleep.
+  if (panel.rstLevel_ == LOW && level == HIGH) {
+    panel.resets++;
+    panel.asleep = false;
+  }
+  panel.rstLevel_ = level;
+}
+
+int Panel::pinLevel(uint8_t pin) {
+  if (pin != panel.busy_) {
+    return -1;
+  }
+  return panel.busy() ? HIGH : LOW;
+}
+
+void Panel::waitWhileBusy() {
+  if (busy()) {
+    hostAdvance(busyUntil_ - hostMicros());
+  }
+}
+
+uint32_t Panel::count(uint8_t command) const {
+  uint32_t n = 0;
+  for (size_t i = 0; i < commands.size(); i++) {
+    if (commands[i].command == command) {
+      n++;
+    }
+  }
+  return n;
+}
+
+void Panel::transfer(uint8_t byte) {
+  if (dc_ >= 0 && digitalRead(dc_) == LOW) {
+    Command command;
+    command.command = byte;
+    commands.push_back(command);
+    if (byte == 0x20 && !asleep) {
+      activate();
+    }
+    return;
+  }
+  if (commands.empty()) {
+    return;
+  }
+  commands.back().data.push_back(byte);
+  if (!asleep) {
+    data(byte);
+  }
+}
+
+void Panel::data(uint8_t byte) {
+  const Command &command = commands.back();
+  size_t i               = command.data.size() - 1;
+  switch (command.command) {
+  case 0x10: // deep sleep mode
+    asleep = byte != 0;
+    break;
+  case 0x22: // display update control 2
+    sequence_ = byte;
+    break;
+  case 0x44: // ram x window, in bytes
+    if (i == 0) {
+      xStart_ = byte;
+    } else if (i == 1) {
+      xEnd_ = byte;
+    }
+    break;
+  case 0x45: // ram y window
+    if (i == 0) {
+      yStart_ = byte;
+    } else if (i == 1) {
+      yStart_ |= uint16_t(byte) << 8;
+    } else if (i == 2) {
+      yEnd_ = byte;
+    } else if (i == 3) {
+      yEnd_ |= uint16_t(byte) << 8;
+    }
+    break;
+  case 0x4e: // ram x address
+    x_ = byte;
+    break;
+  case 0x4f: // ram y address
+    if (i == 0) {
+      y_ = byte;
+    } else if (i == 1) {
+      y_ |= uint16_t(byte) << 8;
+    }
+    break;
+  case 0x24:
+  case 0x26: {
+    // entry mode 0x03: x first, then y, both increasing inside the window
+    uint8_t *image = command.command == 0x24 ? ram : previous;
+    if (x_ < WIDTH / 8 && y_ < HEIGHT) {
+      image[y_ * (WIDTH / 8) + x_] = byte;
+    }
+    if (++x_ > xEnd_) {
+      x_ = xStart_;
+      if (++y_ > yEnd_) {
+        y_ = yStart_;
+      }
+    }
+    break;
+  }
+  }
+}
+
+void Panel::activate() {
+  Update update;
+  update.sequence   = sequence_;
+  update.startedAt  = hostMicros();
+  update.busyMicros = busyMicros(sequence_);
+  updates.push_back(update);
+  busyUntil_ = update.startedAt + update.busyMicros;
+  // every sequence with the display bit set puts ram on the glass
+  if ((sequence_ & 0x04) != 0) {
+    memcpy(shown, ram, sizeof(shown));
+  }
+}
+
+bool writePbm(const char *path, const uint8_t *image) {
+  FILE *f = fopen(path, "wb");
+  if (f == nullptr) {
+    return false;
+  }
+  fprintf(f, "P4\n%d %d\n", Panel::WIDTH, Panel::HEIGHT);
+  // pbm is 1 for black, the controller 1 for white
+  for (uint16_t i = 0; i < Panel::BYTES; i++) {
+    fputc(~image[i] & 0xff, f);
+  }
+  return fclose(f) == 0;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+// a fake SSD1681 on the other end of SPI. it keeps what the display driver
+// sent, what its RAM holds and what the panel shows, and stays busy for as
+// long as the real one does so the simulated clock moves like on the watch.
+
+#include <Arduino.h>
+#include <vector>
+
+class Panel {
+public:
+  static const uint16_t WIDTH  = 200;
+  static const uint16_t HEIGHT = 200;
+  static const uint16_t BYTES  = WIDTH / 8 * HEIGHT;
+
+  typedef struct Command {
+    uint8_t command;
+    std::vector<uint8_t> data;
+  } Command;
+
+  typedef struct Update {
+    uint8_t sequence;   // what 0x22 asked for
+    uint64_t startedAt; // simulated micros
+    uint32_t busyMicros;
+  } Update;
+
+  // since the last clear()
+  std::vector<Command> commands;
+  std::vector<Update> updates;
+  uint32_t resets = 0;
+
+  // controller state, kept across clear() like across deep sleep
+  bool asleep = false;
+  uint8_t ram[BYTES];      // 0x24, the next image
+  uint8_t previous[BYTES]; // 0x26, the image the waveform starts from
+  uint8_t shown[BYTES];    // what the last display update put on the glass
+
+  Panel();
+  void attach(int16_t cs, int16_t dc, int16_t rst, int16_t busy);
+  void clear();
+  // forgets everything, like a board that just got power.
+  void powerCycle();
+
+  void transfer(uint8_t byte);
+  bool busy() const { return hostMicros() < busyUntil_; }
+  void waitWhileBusy();
+  uint32_t count(uint8_t command) const;
+
+  // the pixel at x, y of one of the images above, true for black.
+  static bool black(const uint8_t *image, uint16_t x, uint16_t y) {
+    return (image[y * (WIDTH / 8) + x / 8] & (0x80 >> (x % 8))) == 0;
+  }
+
+private:
+  static void pinChanged(uint8_t pin);
+  static int pinLevel(uint8_t pin);
+  void data(uint8_t byte);
+  void activate();
+
+  int16_t dc_ = -1, rst_ = -1, busy_ = -1;
+  uint8_t rstLevel_  = HIGH;
+  uint64_t busyUntil_ = 0;
+  uint8_t sequence_   = 0;
+  uint8_t xStart_ = 0, xEnd_ = WIDTH / 8 - 1, x_ = 0;
+  uint16_t yStart_ = 0, yEnd_ = HEIGHT - 1, y_ = 0;
+};
+
+extern Panel panel;
+
+// writes a 1 bit image, e.g. panel.shown, as a PBM file.
+bool writePbm(const char *path, const uint8_t *image);
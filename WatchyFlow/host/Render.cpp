@@ -0,0 +1,271 @@
+// draws the calendar face, the menu and the stopwatch through the real
+// Display and layout code into the fake panel, one simulated wake at a
+// time, and writes what the panel shows afterwards as PBM images.
+//
+//   render [dir]         writes dir/<app>.pbm, dir defaults to build
+//   render -b [count]    times count show() calls per app on this machine,
+//                        and counts the layout work they do
+
+#include "HostWatchy.h"
+#include "Layouts.h"
+#include "Panel.h"
+#include "../src/Apps/Calendar/CalendarFace.h"
+#include "../src/Apps/Menu/MenuApp.h"
+#include "../src/Apps/Stopwatch/Stopwatch.h"
+#include "../src/Layout/Arena.h"
+#include "../src/Layout/Layout.h"
+#include <chrono>
+#include <string>
+
+static menuAppMemory menuMem;
+
+static CalendarSettings calendarSettings() {
+  CalendarSettings settings;
+  settings.metric = true;
+  return settings;
+}
+
+// one wake: a new Display over what the last one left in RTC memory, the
+// app drawn like Watchy::wakeup does, and the panel put back to sleep.
+static void wake(WatchyApp *app, HostWatchy *watchy, bool partialRefresh) {
+  Display display;
+  display.epd2.asyncRefresh = true;
+  display.cp437(true);
+  display.powerOnWhileDrawing(watchy->wakeupReason() != WAKEUP_CLOCK);
+  if (!partialRefresh) {
+    app->reset(watchy);
+  }
+  app->show(watchy, &display, partialRefresh);
+  display.hibernate();
+}
+
+static bool save(const std::string &dir, const char *name, uint64_t micros) {
+  std::string path = dir + "/" + name + ".pbm";
+  if (!writePbm(path.c_str(), panel.shown)) {
+    fprintf(stderr, "can't write %s\n", path.c_str());
+    return false;
+  }
+  printf("%-24s %3u commands, %u updates, %7.1f ms\n", path.c_str(),
+         unsigned(panel.commands.size()), unsigned(panel.updates.size()),
+         micros / 1000.0);
+  return true;
+}
+
+static int render(const std::string &dir) {
+  CalendarFace calendar(calendarSettings());
+  StopwatchApp stopwatch;
+  MenuApp menu(&menuMem, "Menu",
+               {
+                   MenuItem("Stopwatch", &stopwatch),
+                   MenuItem("Calendar", &calendar),
+               });
+
+  struct Step {
+    WatchyApp *app;
+    tmElements_t time;
+    WakeupReason reason;
+    const char *name;
+  } steps[] = {
+      {&calendar, hostTime(9, 26, 53), WAKEUP_RESET, "calendar"},
+      {&calendar, hostTime(9, 27, 0), WAKEUP_CLOCK, "calendar-tick"},
+      {&menu, hostTime(9, 27, 10), WAKEUP_BUTTON, "menu"},
+      {&stopwatch, hostTime(9, 28, 5), WAKEUP_BUTTON, "stopwatch"},
+  };
+
+  HostWatchy watchy(steps[0].time, steps[0].reason);
+  bool ok = true;
+  for (size_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+    const Step &step = steps[i];
+    watchy.set(step.time, step.reason);
+    if (step.app == &stopwatch) {
+      // started a minute and five seconds ago
+      stopwatch.reset(&watchy);
+      watchy.set(hostTime(9, 27, 0), step.reason);
+      stopwatch.buttonSelect(&watchy);
+      watchy.set(step.time, step.reason);
+    }
+    menuMem.inApp = false;
+    panel.clear();
+    uint64_t start = hostMicros();
+    wake(step.app, &watchy, step.reason != WAKEUP_RESET);
+    ok = save(dir, step.name, hostMicros() - start) && ok;
+  }
+  return ok ? 0 : 1;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+static double micros(Clock::duration d) {
+  return std::chrono::duration<double, std::micro>(d).count();
+}
+
+// show() builds its layout tree and then fills the screen and draws the
+// tree. this Display adds up the time from starting a show() to the first
+// thing drawn after the fill, without the fill itself, as the tree build.
+class BenchDisplay : public Display {
+public:
+  double buildMicros = 0;
+
+  void startShow() {
+    start_      = Clock::now();
+    filled_     = false;
+    drawn_      = false;
+    fillMicros_ = 0;
+  }
+
+  void fillScreen(uint16_t color) override {
+    Clock::time_point start = Clock::now();
+    Display::fillScreen(color);
+    if (!drawn_) {
+      fillMicros_ += micros(Clock::now() - start);
+      filled_ = true;
+    }
+  }
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    drawing();
+    Display::drawPixel(x, y, color);
+  }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                uint16_t color) override {
+    drawing();
+    Display::fillRect(x, y, w, h, color);
+  }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w,
+                     uint16_t color) override {
+    drawing();
+    Display::drawFastHLine(x, y, w, color);
+  }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h,
+                     uint16_t color) override {
+    drawing();
+    Display::drawFastVLine(x, y, h, color);
+  }
+  size_t write(uint8_t c) override {
+    drawing();
+    return Display::write(c);
+  }
+
+private:
+  void drawing() {
+    if (filled_ && !drawn_) {
+      drawn_ = true;
+      buildMicros += micros(Clock::now() - start_) - fillMicros_;
+    }
+  }
+
+  Clock::time_point start_;
+  bool filled_       = false;
+  bool drawn_        = false;
+  double fillMicros_ = 0;
+};
+
+static int bench(int count) {
+  CalendarFace calendar(calendarSettings());
+  StopwatchApp stopwatch;
+  MenuApp menu(&menuMem, "Menu",
+               {
+                   MenuItem("Stopwatch", &stopwatch),
+                   MenuItem("Calendar", &calendar),
+               });
+  // calendar frames after the first only draw the changed widgets, so it
+  // runs once more with every frame drawn whole.
+  struct Face {
+    WatchyApp *app;
+    const char *name;
+    bool whole;
+  } faces[] = {
+      {&calendar, "calendar", false},
+      {&calendar, "cal-whole", true},
+      {&menu, "menu", false},
+      {&stopwatch, "stopwatch", false},
+  };
+
+  HostWatchy watchy(hostTime(), WAKEUP_BUTTON);
+  BenchDisplay display;
+  display.cp437(true);
+  // per show(), build is the part of us spent building the layout tree.
+  // measure counts LayoutElement::measure calls and size the
+  // ones that had to run size(). arena and heap are the most layout bytes
+  // held at once, in the arena and past its end. sent is bytes written to
+  // the controller and drawn pixels covered in the framebuffer, Mpx/s the
+  // drawn pixels over the whole show() time.
+  printf("%-10s %8s %8s %8s %8s %8s %8s %8s %8s %8s\n", "", "us", "build",
+         "measure", "size", "arena", "heap", "sent", "drawn", "Mpx/s");
+  for (size_t i = 0; i < sizeof(faces) / sizeof(faces[0]); i++) {
+    const Face &face = faces[i];
+    menuMem.inApp    = false;
+    face.app->reset(&watchy);
+    display.drawWholeFrames(face.whole);
+    LayoutElement::measureCalls = 0;
+    LayoutElement::sizeCalls    = 0;
+    uint32_t bytes              = WatchyDisplay::stats().bytesSent;
+    uint32_t pixels             = display.pixelsWritten();
+    display.buildMicros         = 0;
+    ArenaScope arena(globalArena);
+    Clock::time_point start = Clock::now();
+    for (int n = 0; n < count; n++) {
+      // a new minute every call, so the frame always changes
+      watchy.set(hostTime(9, n % 60, 0), WAKEUP_BUTTON);
+      display.startShow();
+      face.app->show(&watchy, &display, true);
+    }
+    double took = micros(Clock::now() - start);
+    bytes  = WatchyDisplay::stats().bytesSent - bytes;
+    pixels = display.pixelsWritten() - pixels;
+    printf("%-10s %8.1f %8.1f %8.1f %8.1f %8u %8u %8.1f %8.1f %8.1f\n",
+           face.name, took / count, display.buildMicros / count,
+           double(LayoutElement::measureCalls) / count,
+           double(LayoutElement::sizeCalls) / count,
+           unsigned(arena.highWater()), unsigned(arena.heapHighWater()),
+           double(bytes) / count, double(pixels) / count, pixels / took);
+  }
+
+  // the Static layouts against the LayoutElement trees they replaced, only
+  // drawn into the buffer. make layout-size compares their code.
+  struct Layout {
+    const char *name;
+    void (*draw)(Watchy *watchy, Display *display);
+  } layouts[] = {
+      {"stopwatch static",
+       [](Watchy *watchy, Display *display) {
+         stopwatchStatic(watchy, display, "0:00:12", "0:01:05", true);
+       }},
+      {"stopwatch dynamic",
+       [](Watchy *watchy, Display *display) {
+         stopwatchDynamic(watchy, display, "0:00:12", "0:01:05", true);
+       }},
+      {"notice static",
+       [](Watchy *watchy, Display *display) {
+         noticeStatic(display, "Connecting...");
+       }},
+      {"notice dynamic",
+       [](Watchy *watchy, Display *display) {
+         noticeDynamic(display, "Connecting...");
+       }},
+  };
+  printf("\n%-18s %8s %8s %8s\n", "", "us", "measure", "arena");
+  for (size_t i = 0; i < sizeof(layouts) / sizeof(layouts[0]); i++) {
+    LayoutElement::measureCalls = 0;
+    ArenaScope arena(globalArena);
+    Clock::time_point start = Clock::now();
+    for (int n = 0; n < count; n++) {
+      ArenaScope frame(globalArena);
+      display.fillScreen(GxEPD_WHITE);
+      layouts[i].draw(&watchy, &display);
+    }
+    double took = micros(Clock::now() - start);
+    printf("%-18s %8.1f %8.1f %8u\n", layouts[i].name, took / count,
+           double(LayoutElement::measureCalls) / count,
+           unsigned(arena.highWater()));
+  }
+
+  display.hibernate();
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1 && std::string(argv[1]) == "-b") {
+    return bench(argc > 2 ? atoi(argv[2]) : 200);
+  }
+  return render(argc > 1 ? argv[1] : "build");
+}
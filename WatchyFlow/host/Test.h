@@ -0,0 +1,25 @@
+#pragma once
+
+// the smallest test harness: CHECK reports a failed condition and carries
+// on, and main returns testResult().
+
+#include <stdio.h>
+
+extern int testFailures;
+
+#define CHECK(cond)                                                            \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+      testFailures++;                                                          \
+    }                                                                          \
+  } while (0)
+
+inline int testResult(const char *name) {
+  if (testFailures > 0) {
+    fprintf(stderr, "%s: %d failed\n", name, testFailures);
+    return 1;
+  }
+  printf("%s: ok\n", name);
+  return 0;
+}
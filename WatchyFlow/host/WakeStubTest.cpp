@@ -0,0 +1,71 @@
+// checks when the V3 wake stub lets a wakeup boot and when it sends the chip
+// straight back to sleep, including around the RTC timer wrapping.
+
+#include "Test.h"
+#include "../src/Watchy/WakeStub.h"
+
+int testFailures = 0;
+
+static const uint64_t WRAP     = 1ULL << WAKE_STUB_TIMER_BITS;
+static const uint64_t SLACK    = WAKE_STUB_SLACK_TICKS;
+static const uint64_t DEADLINE = 5000000;
+
+static void decisions() {
+  // a button, USB or anything but the timer always boots
+  CHECK(wakeStubMustBoot(false, 0, DEADLINE));
+  // nothing armed
+  CHECK(wakeStubMustBoot(true, 1000, 0));
+  // early
+  CHECK(!wakeStubMustBoot(true, 0, DEADLINE));
+  CHECK(!wakeStubMustBoot(true, DEADLINE - SLACK - 1, DEADLINE));
+  // within the slack, on time and late
+  CHECK(wakeStubMustBoot(true, DEADLINE - SLACK, DEADLINE));
+  CHECK(wakeStubMustBoot(true, DEADLINE, DEADLINE));
+  CHECK(wakeStubMustBoot(true, DEADLINE + 60000000, DEADLINE));
+}
+
+static void wrapping() {
+  // armed just before the counter wraps, for a deadline just after
+  CHECK(!wakeStubMustBoot(true, WRAP - 1000, 500));
+  CHECK(!wakeStubMustBoot(true, WRAP - 1, SLACK + 1));
+  CHECK(wakeStubMustBoot(true, WRAP - 1, SLACK - 1));
+  CHECK(wakeStubMustBoot(true, 0, SLACK));
+  // the deadline passed just before the counter wrapped
+  CHECK(wakeStubMustBoot(true, 20, WRAP - 30));
+  // a long way early on either side of the wrap
+  CHECK(!wakeStubMustBoot(true, WRAP - 1, WRAP / 4));
+  CHECK(!wakeStubMustBoot(true, WRAP / 2, WRAP - 1));
+}
+
+static void counters() {
+  WakeStub::reset();
+  CHECK(WakeStub::skipped() == 0);
+
+  wakeStub.deadline = DEADLINE;
+  CHECK(!wakeStubWake(true, DEADLINE / 2));
+  CHECK(!wakeStubWake(true, DEADLINE - SLACK - 1));
+  CHECK(WakeStub::skipped() == 2);
+  CHECK(wakeStub.deadline == DEADLINE);
+
+  // booting disarms, so a later wake boots too
+  CHECK(wakeStubWake(true, DEADLINE));
+  CHECK(wakeStub.deadline == 0);
+  CHECK(wakeStubWake(true, DEADLINE / 2));
+  CHECK(WakeStub::skipped() == 2);
+
+  // a button press before the deadline boots and disarms
+  wakeStub.deadline = DEADLINE;
+  CHECK(wakeStubWake(false, DEADLINE / 2));
+  CHECK(wakeStub.deadline == 0);
+  CHECK(WakeStub::skipped() == 2);
+
+  WakeStub::reset();
+  CHECK(WakeStub::skipped() == 0);
+}
+
+int main() {
+  decisions();
+  wrapping();
+  counters();
+  return testResult("WakeStubTest");
+}
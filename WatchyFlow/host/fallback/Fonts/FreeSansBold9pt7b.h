@@ -0,0 +1,111 @@
+// stands in for FreeSansBold9pt7b from Adafruit GFX when the library is not
+// installed. every character is a 9x13 box with about the real advance and
+// line height, so layout is close to the watch but text is not readable.
+// point GFX_LIBRARY at the library for the real font.
+
+const uint8_t FreeSansBold9pt7bBitmaps[] PROGMEM = {
+    0xFF, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60,
+    0x30, 0x1F, 0xF8,
+};
+
+const GFXglyph FreeSansBold9pt7bGlyphs[] PROGMEM = {
+    {0, 0, 0, 11, 0, 1},    // 0x20 ' '
+    {0, 9, 13, 11, 0, -13}, // 0x21 '!'
+    {0, 9, 13, 11, 0, -13}, // 0x22 '"'
+    {0, 9, 13, 11, 0, -13}, // 0x23 '#'
+    {0, 9, 13, 11, 0, -13}, // 0x24 '$'
+    {0, 9, 13, 11, 0, -13}, // 0x25 '%'
+    {0, 9, 13, 11, 0, -13}, // 0x26 '&'
+    {0, 9, 13, 11, 0, -13}, // 0x27 '\''
+    {0, 9, 13, 11, 0, -13}, // 0x28 '('
+    {0, 9, 13, 11, 0, -13}, // 0x29 ')'
+    {0, 9, 13, 11, 0, -13}, // 0x2A '*'
+    {0, 9, 13, 11, 0, -13}, // 0x2B '+'
+    {0, 9, 13, 11, 0, -13}, // 0x2C ','
+    {0, 9, 13, 11, 0, -13}, // 0x2D '-'
+    {0, 9, 13, 11, 0, -13}, // 0x2E '.'
+    {0, 9, 13, 11, 0, -13}, // 0x2F '/'
+    {0, 9, 13, 11, 0, -13}, // 0x30 '0'
+    {0, 9, 13, 11, 0, -13}, // 0x31 '1'
+    {0, 9, 13, 11, 0, -13}, // 0x32 '2'
+    {0, 9, 13, 11, 0, -13}, // 0x33 '3'
+    {0, 9, 13, 11, 0, -13}, // 0x34 '4'
+    {0, 9, 13, 11, 0, -13}, // 0x35 '5'
+    {0, 9, 13, 11, 0, -13}, // 0x36 '6'
+    {0, 9, 13, 11, 0, -13}, // 0x37 '7'
+    {0, 9, 13, 11, 0, -13}, // 0x38 '8'
+    {0, 9, 13, 11, 0, -13}, // 0x39 '9'
+    {0, 9, 13, 11, 0, -13}, // 0x3A ':'
+    {0, 9, 13, 11, 0, -13}, // 0x3B ';'
+    {0, 9, 13, 11, 0, -13}, // 0x3C '<'
+    {0, 9, 13, 11, 0, -13}, // 0x3D '='
+    {0, 9, 13, 11, 0, -13}, // 0x3E '>'
+    {0, 9, 13, 11, 0, -13}, // 0x3F '?'
+    {0, 9, 13, 11, 0, -13}, // 0x40 '@'
+    {0, 9, 13, 11, 0, -13}, // 0x41 'A'
+    {0, 9, 13, 11, 0, -13}, // 0x42 'B'
+    {0, 9, 13, 11, 0, -13}, // 0x43 'C'
+    {0, 9, 13, 11, 0, -13}, // 0x44 'D'
+    {0, 9, 13, 11, 0, -13}, // 0x45 'E'
+    {0, 9, 13, 11, 0, -13}, // 0x46 'F'
+    {0, 9, 13, 11, 0, -13}, // 0x47 'G'
+    {0, 9, 13, 11, 0, -13}, // 0x48 'H'
+    {0, 9, 13, 11, 0, -13}, // 0x49 'I'
+    {0, 9, 13, 11, 0, -13}, // 0x4A 'J'
+    {0, 9, 13, 11, 0, -13}, // 0x4B 'K'
+    {0, 9, 13, 11, 0, -13}, // 0x4C 'L'
+    {0, 9, 13, 11, 0, -13}, // 0x4D 'M'
+    {0, 9, 13, 11, 0, -13}, // 0x4E 'N'
+    {0, 9, 13, 11, 0, -13}, // 0x4F 'O'
+    {0, 9, 13, 11, 0, -13}, // 0x50 'P'
+    {0, 9, 13, 11, 0, -13}, // 0x51 'Q'
+    {0, 9, 13, 11, 0, -13}, // 0x52 'R'
+    {0, 9, 13, 11, 0, -13}, // 0x53 'S'
+    {0, 9, 13, 11, 0, -13}, // 0x54 'T'
+    {0, 9, 13, 11, 0, -13}, // 0x55 'U'
+    {0, 9, 13, 11, 0, -13}, // 0x56 'V'
+    {0, 9, 13, 11, 0, -13}, // 0x57 'W'
+    {0, 9, 13, 11, 0, -13}, // 0x58 'X'
+    {0, 9, 13, 11, 0, -13}, // 0x59 'Y'
+    {0, 9, 13, 11, 0, -13}, // 0x5A 'Z'
+    {0, 9, 13, 11, 0, -13}, // 0x5B '['
+    {0, 9, 13, 11, 0, -13}, // 0x5C '\\'
+    {0, 9, 13, 11, 0, -13}, // 0x5D ']'
+    {0, 9, 13, 11, 0, -13}, // 0x5E '^'
+    {0, 9, 13, 11, 0, -13}, // 0x5F '_'
+    {0, 9, 13, 11, 0, -13}, // 0x60 '`'
+    {0, 9, 13, 11, 0, -13}, // 0x61 'a'
+    {0, 9, 13, 11, 0, -13}, // 0x62 'b'
+    {0, 9, 13, 11, 0, -13}, // 0x63 'c'
+    {0, 9, 13, 11, 0, -13}, // 0x64 'd'
+    {0, 9, 13, 11, 0, -13}, // 0x65 'e'
+    {0, 9, 13, 11, 0, -13}, // 0x66 'f'
+    {0, 9, 13, 11, 0, -13}, // 0x67 'g'
+    {0, 9, 13, 11, 0, -13}, // 0x68 'h'
+    {0, 9, 13, 11, 0, -13}, // 0x69 'i'
+    {0, 9, 13, 11, 0, -13}, // 0x6A 'j'
+    {0, 9, 13, 11, 0, -13}, // 0x6B 'k'
+    {0, 9, 13, 11, 0, -13}, // 0x6C 'l'
+    {0, 9, 13, 11, 0, -13}, // 0x6D 'm'
+    {0, 9, 13, 11, 0, -13}, // 0x6E 'n'
+    {0, 9, 13, 11, 0, -13}, // 0x6F 'o'
+    {0, 9, 13, 11, 0, -13}, // 0x70 'p'
+    {0, 9, 13, 11, 0, -13}, // 0x71 'q'
+    {0, 9, 13, 11, 0, -13}, // 0x72 'r'
+    {0, 9, 13, 11, 0, -13}, // 0x73 's'
+    {0, 9, 13, 11, 0, -13}, // 0x74 't'
+    {0, 9, 13, 11, 0, -13}, // 0x75 'u'
+    {0, 9, 13, 11, 0, -13}, // 0x76 'v'
+    {0, 9, 13, 11, 0, -13}, // 0x77 'w'
+    {0, 9, 13, 11, 0, -13}, // 0x78 'x'
+    {0, 9, 13, 11, 0, -13}, // 0x79 'y'
+    {0, 9, 13, 11, 0, -13}, // 0x7A 'z'
+    {0, 9, 13, 11, 0, -13}, // 0x7B '{'
+    {0, 9, 13, 11, 0, -13}, // 0x7C '|'
+    {0, 9, 13, 11, 0, -13}, // 0x7D '}'
+    {0, 9, 13, 11, 0, -13}, // 0x7E '~'
+};
+
+const GFXfont FreeSansBold9pt7b PROGMEM = {(uint8_t *)FreeSansBold9pt7bBitmaps,
+                                           (GFXglyph *)FreeSansBold9pt7bGlyphs,
+                                           0x20, 0x7E, 22};
@@ -0,0 +1,109 @@
+// stands in for Picopixel from Adafruit GFX when the library is not
+// installed. every character is a 3x5 box with about the real advance and
+// line height, so layout is close to the watch but text is not readable.
+// point GFX_LIBRARY at the library for the real font.
+
+const uint8_t PicopixelBitmaps[] PROGMEM = {
+    0xF6, 0xDE,
+};
+
+const GFXglyph PicopixelGlyphs[] PROGMEM = {
+    {0, 0, 0, 4, 0, 1},  // 0x20 ' '
+    {0, 3, 5, 4, 0, -5}, // 0x21 '!'
+    {0, 3, 5, 4, 0, -5}, // 0x22 '"'
+    {0, 3, 5, 4, 0, -5}, // 0x23 '#'
+    {0, 3, 5, 4, 0, -5}, // 0x24 '$'
+    {0, 3, 5, 4, 0, -5}, // 0x25 '%'
+    {0, 3, 5, 4, 0, -5}, // 0x26 '&'
+    {0, 3, 5, 4, 0, -5}, // 0x27 '\''
+    {0, 3, 5, 4, 0, -5}, // 0x28 '('
+    {0, 3, 5, 4, 0, -5}, // 0x29 ')'
+    {0, 3, 5, 4, 0, -5}, // 0x2A '*'
+    {0, 3, 5, 4, 0, -5}, // 0x2B '+'
+    {0, 3, 5, 4, 0, -5}, // 0x2C ','
+    {0, 3, 5, 4, 0, -5}, // 0x2D '-'
+    {0, 3, 5, 4, 0, -5}, // 0x2E '.'
+    {0, 3, 5, 4, 0, -5}, // 0x2F '/'
+    {0, 3, 5, 4, 0, -5}, // 0x30 '0'
+    {0, 3, 5, 4, 0, -5}, // 0x31 '1'
+    {0, 3, 5, 4, 0, -5}, // 0x32 '2'
+    {0, 3, 5, 4, 0, -5}, // 0x33 '3'
+    {0, 3, 5, 4, 0, -5}, // 0x34 '4'
+    {0, 3, 5, 4, 0, -5}, // 0x35 '5'
+    {0, 3, 5, 4, 0, -5}, // 0x36 '6'
+    {0, 3, 5, 4, 0, -5}, // 0x37 '7'
+    {0, 3, 5, 4, 0, -5}, // 0x38 '8'
+    {0, 3, 5, 4, 0, -5}, // 0x39 '9'
+    {0, 3, 5, 4, 0, -5}, // 0x3A ':'
+    {0, 3, 5, 4, 0, -5}, // 0x3B ';'
+    {0, 3, 5, 4, 0, -5}, // 0x3C '<'
+    {0, 3, 5, 4, 0, -5}, // 0x3D '='
+    {0, 3, 5, 4, 0, -5}, // 0x3E '>'
+    {0, 3, 5, 4, 0, -5}, // 0x3F '?'
+    {0, 3, 5, 4, 0, -5}, // 0x40 '@'
+    {0, 3, 5, 4, 0, -5}, // 0x41 'A'
+    {0, 3, 5, 4, 0, -5}, // 0x42 'B'
+    {0, 3, 5, 4, 0, -5}, // 0x43 'C'
+    {0, 3, 5, 4, 0, -5}, // 0x44 'D'
+    {0, 3, 5, 4, 0, -5}, // 0x45 'E'
+    {0, 3, 5, 4, 0, -5}, // 0x46 'F'
+    {0, 3, 5, 4, 0, -5}, // 0x47 'G'
+    {0, 3, 5, 4, 0, -5}, // 0x48 'H'
+    {0, 3, 5, 4, 0, -5}, // 0x49 'I'
+    {0, 3, 5, 4, 0, -5}, // 0x4A 'J'
+    {0, 3, 5, 4, 0, -5}, // 0x4B 'K'
+    {0, 3, 5, 4, 0, -5}, // 0x4C 'L'
+    {0, 3, 5, 4, 0, -5}, // 0x4D 'M'
+    {0, 3, 5, 4, 0, -5}, // 0x4E 'N'
+    {0, 3, 5, 4, 0, -5}, // 0x4F 'O'
+    {0, 3, 5, 4, 0, -5}, // 0x50 'P'
+    {0, 3, 5, 4, 0, -5}, // 0x51 'Q'
+    {0, 3, 5, 4, 0, -5}, // 0x52 'R'
+    {0, 3, 5, 4, 0, -5}, // 0x53 'S'
+    {0, 3, 5, 4, 0, -5}, // 0x54 'T'
+    {0, 3, 5, 4, 0, -5}, // 0x55 'U'
+    {0, 3, 5, 4, 0, -5}, // 0x56 'V'
+    {0, 3, 5, 4, 0, -5}, // 0x57 'W'
+    {0, 3, 5, 4, 0, -5}, // 0x58 'X'
+    {0, 3, 5, 4, 0, -5}, // 0x59 'Y'
+    {0, 3, 5, 4, 0, -5}, // 0x5A 'Z'
+    {0, 3, 5, 4, 0, -5}, // 0x5B '['
+    {0, 3, 5, 4, 0, -5}, // 0x5C '\\'
+    {0, 3, 5, 4, 0, -5}, // 0x5D ']'
+    {0, 3, 5, 4, 0, -5}, // 0x5E '^'
+    {0, 3, 5, 4, 0, -5}, // 0x5F '_'
+    {0, 3, 5, 4, 0, -5}, // 0x60 '`'
+    {0, 3, 5, 4, 0, -5}, // 0x61 'a'
+    {0, 3, 5, 4, 0, -5}, // 0x62 'b'
+    {0, 3, 5, 4, 0, -5}, // 0x63 'c'
+    {0, 3, 5, 4, 0, -5}, // 0x64 'd'
+    {0, 3, 5, 4, 0, -5}, // 0x65 'e'
+    {0, 3, 5, 4, 0, -5}, // 0x66 'f'
+    {0, 3, 5, 4, 0, -5}, // 0x67 'g'
+    {0, 3, 5, 4, 0, -5}, // 0x68 'h'
+    {0, 3, 5, 4, 0, -5}, // 0x69 'i'
+    {0, 3, 5, 4, 0, -5}, // 0x6A 'j'
+    {0, 3, 5, 4, 0, -5}, // 0x6B 'k'
+    {0, 3, 5, 4, 0, -5}, // 0x6C 'l'
+    {0, 3, 5, 4, 0, -5}, // 0x6D 'm'
+    {0, 3, 5, 4, 0, -5}, // 0x6E 'n'
+    {0, 3, 5, 4, 0, -5}, // 0x6F 'o'
+    {0, 3, 5, 4, 0, -5}, // 0x70 'p'
+    {0, 3, 5, 4, 0, -5}, // 0x71 'q'
+    {0, 3, 5, 4, 0, -5}, // 0x72 'r'
+    {0, 3, 5, 4, 0, -5}, // 0x73 's'
+    {0, 3, 5, 4, 0, -5}, // 0x74 't'
+    {0, 3, 5, 4, 0, -5}, // 0x75 'u'
+    {0, 3, 5, 4, 0, -5}, // 0x76 'v'
+    {0, 3, 5, 4, 0, -5}, // 0x77 'w'
+    {0, 3, 5, 4, 0, -5}, // 0x78 'x'
+    {0, 3, 5, 4, 0, -5}, // 0x79 'y'
+    {0, 3, 5, 4, 0, -5}, // 0x7A 'z'
+    {0, 3, 5, 4, 0, -5}, // 0x7B '{'
+    {0, 3, 5, 4, 0, -5}, // 0x7C '|'
+    {0, 3, 5, 4, 0, -5}, // 0x7D '}'
+    {0, 3, 5, 4, 0, -5}, // 0x7E '~'
+};
+
+const GFXfont Picopixel PROGMEM = {(uint8_t *)PicopixelBitmaps,
+                                   (GFXglyph *)PicopixelGlyphs, 0x20, 0x7E, 7};
@@ -0,0 +1,255 @@
+#include <Adafruit_GFX.h>
+#include <glcdfont.c>
+#include <algorithm>
+#include <stdlib.h>
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h)
+    : WIDTH(w), HEIGHT(h), _width(w), _height(h), cursor_x(0), cursor_y(0),
+      textcolor(0xFFFF), textbgcolor(0xFFFF), textsize_x(1), textsize_y(1),
+      rotation(0), wrap(true), _cp437(false), gfxFont(NULL) {}
+
+void Adafruit_GFX::writePixel(int16_t x, int16_t y, uint16_t color) {
+  drawPixel(x, y, color);
+}
+
+void Adafruit_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 uint16_t color) {
+  fillRect(x, y, w, h, color);
+}
+
+void Adafruit_GFX::writeFastVLine(int16_t x, int16_t y, int16_t h,
+                                  uint16_t color) {
+  drawFastVLine(x, y, h, color);
+}
+
+void Adafruit_GFX::writeFastHLine(int16_t x, int16_t y, int16_t w,
+                                  uint16_t color) {
+  drawFastHLine(x, y, w, color);
+}
+
+void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                             uint16_t color) {
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) {
+    std::swap(x0, y0);
+    std::swap(x1, y1);
+  }
+  if (x0 > x1) {
+    std::swap(x0, x1);
+    std::swap(y0, y1);
+  }
+  int16_t dx    = x1 - x0;
+  int16_t dy    = abs(y1 - y0);
+  int16_t err   = dx / 2;
+  int16_t ystep = y0 < y1 ? 1 : -1;
+  for (; x0 <= x1; x0++) {
+    if (steep) {
+      writePixel(y0, x0, color);
+    } else {
+      writePixel(x0, y0, color);
+    }
+    err -= dy;
+    if (err < 0) {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}
+
+void Adafruit_GFX::setRotation(uint8_t r) {
+  rotation = r & 3;
+  if (rotation == 0 || rotation == 2) {
+    _width  = WIDTH;
+    _height = HEIGHT;
+  } else {
+    _width  = HEIGHT;
+    _height = WIDTH;
+  }
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                 uint16_t color) {
+  writeLine(x, y, x, y + h - 1, color);
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                 uint16_t color) {
+  writeLine(x, y, x + w - 1, y, color);
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint16_t color) {
+  for (int16_t i = x; i < x + w; i++) {
+    writeFastVLine(i, y, h, color);
+  }
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                            uint16_t color) {
+  if (x0 == x1) {
+    if (y0 > y1) {
+      std::swap(y0, y1);
+    }
+    drawFastVLine(x0, y0, y1 - y0 + 1, color);
+  } else if (y0 == y1) {
+    if (x0 > x1) {
+      std::swap(x0, x1);
+    }
+    drawFastHLine(x0, y0, x1 - x0 + 1, color);
+  } else {
+    writeLine(x0, y0, x1, y1, color);
+  }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint16_t color) {
+  writeFastHLine(x, y, w, color);
+  writeFastHLine(x, y + h - 1, w, color);
+  writeFastVLine(x, y, h, color);
+  writeFastVLine(x + w - 1, y, h, color);
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                              int16_t w, int16_t h, uint16_t color) {
+  int16_t byteWidth = (w + 7) / 8;
+  uint8_t b         = 0;
+  for (int16_t j = 0; j < h; j++, y++) {
+    for (int16_t i = 0; i < w; i++) {
+      if (i & 7) {
+        b <<= 1;
+      } else {
+        b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+      }
+      if (b & 0x80) {
+        writePixel(x + i, y, color);
+      }
+    }
+  }
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                              int16_t w, int16_t h, uint16_t color,
+                              uint16_t bg) {
+  int16_t byteWidth = (w + 7) / 8;
+  uint8_t b         = 0;
+  for (int16_t j = 0; j < h; j++, y++) {
+    for (int16_t i = 0; i < w; i++) {
+      if (i & 7) {
+        b <<= 1;
+      } else {
+        b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+      }
+      writePixel(x + i, y, (b & 0x80) ? color : bg);
+    }
+  }
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
+                            uint16_t color, uint16_t bg, uint8_t size_x,
+                            uint8_t size_y) {
+  bool scaled = size_x != 1 || size_y != 1;
+  if (gfxFont == NULL) {
+    if (x >= _width || y >= _height || x + 6 * size_x - 1 < 0 ||
+        y + 8 * size_y - 1 < 0) {
+      return;
+    }
+    if (!_cp437 && c >= 176) {
+      c++;
+    }
+    for (int8_t i = 0; i < 5; i++) {
+      uint8_t line = pgm_read_byte(&font[c * 5 + i]);
+      for (int8_t j = 0; j < 8; j++, line >>= 1) {
+        if ((line & 1) == 0 && bg == color) {
+          continue;
+        }
+        uint16_t pixel = (line & 1) ? color : bg;
+        if (scaled) {
+          writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, pixel);
+        } else {
+          writePixel(x + i, y + j, pixel);
+        }
+      }
+    }
+    if (bg != color) {
+      if (scaled) {
+        writeFillRect(x + 5 * size_x, y, size_x, 8 * size_y, bg);
+      } else {
+        writeFastVLine(x + 5, y, 8, bg);
+      }
+    }
+    return;
+  }
+
+  c -= gfxFont->first;
+  const GFXglyph *glyph = &gfxFont->glyph[c];
+  const uint8_t *bitmap = gfxFont->bitmap;
+  uint16_t bo           = glyph->bitmapOffset;
+  uint8_t bits = 0, bit = 0;
+  for (uint8_t yy = 0; yy < glyph->height; yy++) {
+    for (uint8_t xx = 0; xx < glyph->width; xx++) {
+      if (!(bit++ & 7)) {
+        bits = pgm_read_byte(&bitmap[bo++]);
+      }
+      if (bits & 0x80) {
+        if (scaled) {
+          writeFillRect(x + (glyph->xOffset + xx) * size_x,
+                        y + (glyph->yOffset + yy) * size_y, size_x, size_y,
+                        color);
+        } else {
+          writePixel(x + glyph->xOffset + xx, y + glyph->yOffset + yy, color);
+        }
+      }
+      bits <<= 1;
+    }
+  }
+}
+
+void Adafruit_GFX::setFont(const GFXfont *f) {
+  // the built-in font is drawn from its top left, GFX fonts from the
+  // baseline. the library moves the cursor so switching keeps the line.
+  if (f != NULL && gfxFont == NULL) {
+    cursor_y += 6;
+  } else if (f == NULL && gfxFont != NULL) {
+    cursor_y -= 6;
+  }
+  gfxFont = (GFXfont *)f;
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (gfxFont == NULL) {
+    if (c == '\n') {
+      cursor_x = 0;
+      cursor_y += textsize_y * 8;
+    } else if (c != '\r') {
+      if (wrap && cursor_x + textsize_x * 6 > _width) {
+        cursor_x = 0;
+        cursor_y += textsize_y * 8;
+      }
+      drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x,
+               textsize_y);
+      cursor_x += textsize_x * 6;
+    }
+    return 1;
+  }
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += (int16_t)textsize_y * gfxFont->yAdvance;
+  } else if (c != '\r' && c >= gfxFont->first && c <= gfxFont->last) {
+    const GFXglyph *glyph = &gfxFont->glyph[c - gfxFont->first];
+    if (glyph->width > 0 && glyph->height > 0) {
+      if (wrap && cursor_x + textsize_x * (glyph->xOffset + glyph->width) >
+                      _width) {
+        cursor_x = 0;
+        cursor_y += (int16_t)textsize_y * gfxFont->yAdvance;
+      }
+      drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x,
+               textsize_y);
+    }
+    cursor_x += glyph->xAdvance * (int16_t)textsize_x;
+  }
+  return 1;
+}
@@ -0,0 +1,154 @@
+#include <Arduino.h>
+#include <stdarg.h>
+#include <algorithm>
+
+static uint64_t clock_;
+static uint8_t levels_[64];
+
+void (*hostPinChanged)(uint8_t pin) = nullptr;
+int (*hostPinLevel)(uint8_t pin)     = nullptr;
+
+uint64_t hostMicros() { return clock_; }
+
+void hostAdvance(uint64_t micros) { clock_ += micros; }
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (mode == INPUT_PULLUP) {
+    levels_[pin] = HIGH;
+  }
+  if (hostPinChanged != nullptr) {
+    hostPinChanged(pin);
+  }
+}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+  levels_[pin] = level;
+  if (hostPinChanged != nullptr) {
+    hostPinChanged(pin);
+  }
+}
+
+int digitalRead(uint8_t pin) {
+  int level = hostPinLevel == nullptr ? -1 : hostPinLevel(pin);
+  return level >= 0 ? level : levels_[pin];
+}
+
+unsigned long millis() { return clock_ / 1000; }
+
+unsigned long micros() { return clock_; }
+
+void delay(uint32_t ms) { clock_ += uint64_t(ms) * 1000; }
+
+void delayMicroseconds(uint32_t us) { clock_ += us; }
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  while (size-- > 0) {
+    n += write(*buffer++);
+  }
+  return n;
+}
+
+size_t Print::print(const String &str) { return write(str.c_str()); }
+
+size_t Print::print(long n, int base) { return print(String(n, base)); }
+
+size_t Print::print(unsigned long n, int base) {
+  return print(String(n, base));
+}
+
+size_t Print::print(double n, int digits) { return print(String(n, digits)); }
+
+size_t Print::printf(const char *format, ...) {
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (len < 0) {
+    return 0;
+  }
+  return write((const uint8_t *)buf, std::min(size_t(len), sizeof(buf) - 1));
+}
+
+static std::string inBase(unsigned long n, unsigned char base) {
+  if (base < 2) {
+    base = 10;
+  }
+  std::string s;
+  do {
+    s.insert(s.begin(), "0123456789abcdefghijklmnopqrstuvwxyz"[n % base]);
+    n /= base;
+  } while (n > 0);
+  return s;
+}
+
+String::String(int n, unsigned char base) : String(long(n), base) {}
+
+String::String(unsigned int n, unsigned char base)
+    : String((unsigned long)n, base) {}
+
+String::String(long n, unsigned char base) {
+  if (n < 0 && base == 10) {
+    s_ = "-" + inBase((unsigned long)-n, base);
+  } else {
+    s_ = inBase((unsigned long)n, base);
+  }
+}
+
+String::String(unsigned long n, unsigned char base) : s_(inBase(n, base)) {}
+
+String::String(double n, unsigned int digits) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", digits, n);
+  s_ = buf;
+}
+
+String String::substring(unsigned int from) const {
+  return substring(from, s_.size());
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if (from > to) {
+    std::swap(from, to);
+  }
+  if (from >= s_.size()) {
+    return String();
+  }
+  return String(s_.substr(from, to - from));
+}
+
+int String::indexOf(const String &str) const {
+  size_t i = s_.find(str.s_);
+  return i == std::string::npos ? -1 : int(i);
+}
+
+void String::replace(const String &find, const String &with) {
+  if (find.s_.empty()) {
+    return;
+  }
+  size_t i = 0;
+  while ((i = s_.find(find.s_, i)) != std::string::npos) {
+    s_.replace(i, find.s_.size(), with.s_);
+    i += with.s_.size();
+  }
+}
+
+void String::trim() {
+  size_t first = s_.find_first_not_of(" \t\r\n");
+  if (first == std::string::npos) {
+    s_.clear();
+    return;
+  }
+  size_t last = s_.find_last_not_of(" \t\r\n");
+  s_          = s_.substr(first, last - first + 1);
+}
+
+void String::toCharArray(char *buf, unsigned int size) const {
+  if (size == 0) {
+    return;
+  }
+  size_t n = std::min(size_t(size - 1), s_.size());
+  memcpy(buf, s_.data(), n);
+  buf[n] = 0;
+}
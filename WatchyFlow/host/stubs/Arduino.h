@@ -0,0 +1,168 @@
+#pragma once
+
+// just enough of the Arduino core to build the drawing code on Linux. time
+// is simulated: it only moves when something waits.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+
+#define RTC_DATA_ATTR
+#define RTC_FAST_ATTR
+#define RTC_IRAM_ATTR
+#define IRAM_ATTR
+#define PROGMEM
+
+#define pgm_read_byte(addr)    (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)    (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr)   (*(const uint32_t *)(addr))
+#define pgm_read_pointer(addr) (*(void *const *)(addr))
+
+#define BIT64(n) (1ULL << (n))
+
+#define HIGH 1
+#define LOW  0
+
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+
+typedef uint8_t byte;
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+inline void yield() {}
+
+// the simulated clock.
+uint64_t hostMicros();
+void hostAdvance(uint64_t micros);
+// for fake peripherals: called whenever a pin's level or mode changes, and
+// asked for the level of a pin they drive. -1 leaves it to the last write.
+extern void (*hostPinChanged)(uint8_t pin);
+extern int (*hostPinLevel)(uint8_t pin);
+
+class String;
+
+class Print {
+public:
+  virtual ~Print() = default;
+
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  size_t write(const char *str) {
+    return write((const uint8_t *)str, strlen(str));
+  }
+
+  size_t print(const char *str) { return write(str); }
+  size_t print(const String &str);
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int n, int base = 10) { return print(long(n), base); }
+  size_t print(unsigned int n, int base = 10) {
+    return print((unsigned long)n, base);
+  }
+  size_t print(long n, int base = 10);
+  size_t print(unsigned long n, int base = 10);
+  size_t print(long long n, int base = 10) { return print(long(n), base); }
+  size_t print(unsigned long long n, int base = 10) {
+    return print((unsigned long)n, base);
+  }
+  size_t print(double n, int digits = 2);
+
+  template <typename T> size_t println(T value) {
+    size_t n = print(value);
+    return n + println();
+  }
+  template <typename T> size_t println(T value, int format) {
+    size_t n = print(value, format);
+    return n + println();
+  }
+  size_t println() { return write("\r\n"); }
+
+  size_t printf(const char *format, ...)
+      __attribute__((format(printf, 2, 3)));
+};
+
+class String {
+public:
+  String(const char *str = "") : s_(str == nullptr ? "" : str) {}
+  String(const std::string &str) : s_(str) {}
+  explicit String(char c) : s_(1, c) {}
+  explicit String(int n, unsigned char base = 10);
+  explicit String(unsigned int n, unsigned char base = 10);
+  explicit String(long n, unsigned char base = 10);
+  explicit String(unsigned long n, unsigned char base = 10);
+  explicit String(long long n, unsigned char base = 10)
+      : String(long(n), base) {}
+  explicit String(unsigned long long n, unsigned char base = 10)
+      : String((unsigned long)n, base) {}
+  explicit String(float n, unsigned int digits = 2)
+      : String(double(n), digits) {}
+  explicit String(double n, unsigned int digits = 2);
+
+  unsigned int length() const { return s_.size(); }
+  const char *c_str() const { return s_.c_str(); }
+  bool reserve(unsigned int size) {
+    s_.reserve(size);
+    return true;
+  }
+
+  char charAt(unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+  char &operator[](unsigned int i) { return s_[i]; }
+
+  String &operator+=(const String &other) {
+    s_ += other.s_;
+    return *this;
+  }
+  String &operator+=(const char *other) {
+    s_ += other;
+    return *this;
+  }
+  String &operator+=(char c) {
+    s_ += c;
+    return *this;
+  }
+
+  bool operator==(const String &other) const { return s_ == other.s_; }
+  bool operator==(const char *other) const { return s_ == other; }
+  bool operator!=(const String &other) const { return s_ != other.s_; }
+  bool operator!=(const char *other) const { return s_ != other; }
+
+  String substring(unsigned int from) const;
+  String substring(unsigned int from, unsigned int to) const;
+  int indexOf(const String &str) const;
+  void replace(const String &find, const String &with);
+  void trim();
+  long toInt() const { return atol(s_.c_str()); }
+  void toCharArray(char *buf, unsigned int size) const;
+
+private:
+  std::string s_;
+};
+
+inline String operator+(const String &a, const String &b) {
+  String s(a);
+  s += b;
+  return s;
+}
+inline String operator+(const String &a, const char *b) {
+  return a + String(b);
+}
+inline String operator+(const char *a, const String &b) {
+  return String(a) + b;
+}
+inline String operator+(const String &a, char b) { return a + String(b); }
+
+// the ESP32 core pulls these in everywhere too.
+#include "pins_arduino.h"
+#include "esp_sleep.h"
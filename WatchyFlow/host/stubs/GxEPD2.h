@@ -0,0 +1,11 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+class GxEPD2 {
+public:
+  enum Panel { GDEH0154D67 };
+};
@@ -0,0 +1,120 @@
+#include <GxEPD2_EPD.h>
+#include "../Panel.h"
+
+GxEPD2_EPD::GxEPD2_EPD(int16_t cs, int16_t dc, int16_t rst, int16_t busy,
+                       int16_t busy_level, uint32_t busy_timeout, uint16_t w,
+                       uint16_t h, GxEPD2::Panel p, bool c, bool pu, bool fpu)
+    : WIDTH(w), HEIGHT(h), panel(p), hasColor(c), hasPartialUpdate(pu),
+      hasFastPartialUpdate(fpu), _cs(cs), _dc(dc), _rst(rst), _busy(busy),
+      _busy_level(busy_level), _busy_timeout(busy_timeout),
+      _diag_enabled(false), _pulldown_rst_mode(false), _pSPIx(&SPI),
+      _initial_write(true), _initial_refresh(true), _power_is_on(false),
+      _using_partial_mode(false), _hibernating(false),
+      _init_display_done(false), _reset_duration(10),
+      _busy_callback(nullptr), _busy_callback_parameter(nullptr) {
+  ::panel.attach(cs, dc, rst, busy);
+}
+
+void GxEPD2_EPD::init(uint32_t serial_diag_bitrate, bool initial,
+                      uint16_t reset_duration, bool pulldown_rst_mode) {
+  _initial_write      = initial;
+  _initial_refresh    = initial;
+  _pulldown_rst_mode  = pulldown_rst_mode;
+  _power_is_on        = false;
+  _using_partial_mode = false;
+  _hibernating        = false;
+  _init_display_done  = false;
+  _reset_duration     = reset_duration;
+  if (_cs >= 0) {
+    digitalWrite(_cs, HIGH);
+    pinMode(_cs, OUTPUT);
+  }
+  if (_dc >= 0) {
+    digitalWrite(_dc, HIGH);
+    pinMode(_dc, OUTPUT);
+  }
+  _reset();
+  if (_busy >= 0) {
+    pinMode(_busy, INPUT);
+  }
+}
+
+void GxEPD2_EPD::setBusyCallback(void (*busyCallback)(const void *),
+                                 const void *busy_callback_parameter) {
+  _busy_callback           = busyCallback;
+  _busy_callback_parameter = busy_callback_parameter;
+}
+
+void GxEPD2_EPD::selectSPI(SPIClass &spi, SPISettings spi_settings) {
+  _pSPIx        = &spi;
+  _spi_settings = spi_settings;
+}
+
+void GxEPD2_EPD::_reset() {
+  if (_rst < 0) {
+    return;
+  }
+  if (_pulldown_rst_mode) {
+    digitalWrite(_rst, LOW);
+    pinMode(_rst, OUTPUT);
+    delay(_reset_duration);
+    pinMode(_rst, INPUT_PULLUP);
+    delay(_reset_duration > 10 ? _reset_duration : 10);
+  } else {
+    digitalWrite(_rst, HIGH);
+    pinMode(_rst, OUTPUT);
+    delay(10);
+    digitalWrite(_rst, LOW);
+    delay(_reset_duration);
+    digitalWrite(_rst, HIGH);
+    delay(_reset_duration > 10 ? _reset_duration : 10);
+  }
+  _hibernating = false;
+}
+
+void GxEPD2_EPD::_waitWhileBusy(const char *comment, uint16_t busy_time) {
+  if (_busy < 0) {
+    delay(busy_time);
+    return;
+  }
+  delay(1);
+  if (digitalRead(_busy) == _busy_level && _busy_callback != nullptr) {
+    _busy_callback(_busy_callback_parameter);
+  }
+  // the panel model knows how long its refresh takes.
+  ::panel.waitWhileBusy();
+}
+
+void GxEPD2_EPD::_writeCommand(uint8_t c) {
+  _startTransfer();
+  if (_dc >= 0) {
+    digitalWrite(_dc, LOW);
+  }
+  _pSPIx->transfer(c);
+  if (_dc >= 0) {
+    digitalWrite(_dc, HIGH);
+  }
+  _endTransfer();
+}
+
+void GxEPD2_EPD::_writeData(uint8_t d) {
+  _startTransfer();
+  _pSPIx->transfer(d);
+  _endTransfer();
+}
+
+void GxEPD2_EPD::_startTransfer() {
+  _pSPIx->beginTransaction(_spi_settings);
+  if (_cs >= 0) {
+    digitalWrite(_cs, LOW);
+  }
+}
+
+void GxEPD2_EPD::_transfer(uint8_t value) { _pSPIx->transfer(value); }
+
+void GxEPD2_EPD::_endTransfer() {
+  if (_cs >= 0) {
+    digitalWrite(_cs, HIGH);
+  }
+  _pSPIx->endTransaction();
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+// the part of GxEPD2's base class WatchyDisplay builds on, talking to the
+// fake controller in Panel.h.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <GxEPD2.h>
+
+class GxEPD2_EPD {
+public:
+  const uint16_t WIDTH;
+  const uint16_t HEIGHT;
+  const GxEPD2::Panel panel;
+  const bool hasColor;
+  const bool hasPartialUpdate;
+  const bool hasFastPartialUpdate;
+
+  GxEPD2_EPD(int16_t cs, int16_t dc, int16_t rst, int16_t busy,
+             int16_t busy_level, uint32_t busy_timeout, uint16_t w, uint16_t h,
+             GxEPD2::Panel p, bool c, bool pu, bool fpu);
+  virtual ~GxEPD2_EPD() = default;
+
+  virtual void init(uint32_t serial_diag_bitrate, bool initial,
+                    uint16_t reset_duration = 10,
+                    bool pulldown_rst_mode  = false);
+  void setBusyCallback(void (*busyCallback)(const void *),
+                       const void *busy_callback_parameter = 0);
+  void selectSPI(SPIClass &spi, SPISettings spi_settings);
+
+protected:
+  void _reset();
+  void _waitWhileBusy(const char *comment = 0, uint16_t busy_time = 5000);
+  void _writeCommand(uint8_t c);
+  void _writeData(uint8_t d);
+  void _startTransfer();
+  void _transfer(uint8_t value);
+  void _endTransfer();
+
+protected:
+  int16_t _cs, _dc, _rst, _busy, _busy_level;
+  uint32_t _busy_timeout;
+  bool _diag_enabled, _pulldown_rst_mode;
+  SPIClass *_pSPIx;
+  SPISettings _spi_settings;
+  bool _initial_write, _initial_refresh;
+  bool _power_is_on, _using_partial_mode, _hibernating;
+  bool _init_display_done;
+  uint16_t _reset_duration;
+  void (*_busy_callback)(const void *);
+  const void *_busy_callback_parameter;
+};
@@ -0,0 +1,22 @@
+#include <SPI.h>
+#include "../Panel.h"
+
+SPIClass SPI;
+
+uint8_t SPIClass::transfer(uint8_t data) {
+  panel.transfer(data);
+  return 0;
+}
+
+void SPIClass::writeBytes(const uint8_t *data, uint32_t size) {
+  for (uint32_t i = 0; i < size; i++) {
+    panel.transfer(data[i]);
+  }
+}
+
+void SPIClass::writePattern(const uint8_t *data, uint8_t size,
+                            uint32_t repeat) {
+  for (uint32_t i = 0; i < repeat; i++) {
+    writeBytes(data, size);
+  }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define MSBFIRST  1
+#define SPI_MODE0 0
+
+class SPISettings {
+public:
+  SPISettings() {}
+  SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) {}
+};
+
+// every byte goes to the fake panel controller.
+class SPIClass {
+public:
+  void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1,
+             int8_t ss = -1) {}
+  void beginTransaction(SPISettings settings) {}
+  void endTransaction() {}
+  uint8_t transfer(uint8_t data);
+  void writeBytes(const uint8_t *data, uint32_t size);
+  void writePattern(const uint8_t *data, uint8_t size, uint32_t repeat);
+};
+
+extern SPIClass SPI;
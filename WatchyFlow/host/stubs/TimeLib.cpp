@@ -0,0 +1,89 @@
+#include <TimeLib.h>
+
+#define LEAP_YEAR(Y)                                                           \
+  (((1970 + (Y)) > 0) && !((1970 + (Y)) % 4) &&                                \
+   (((1970 + (Y)) % 100) || !((1970 + (Y)) % 400)))
+
+static const uint8_t monthDays[] = {31, 28, 31, 30, 31, 30,
+                                    31, 31, 30, 31, 30, 31};
+
+void breakTime(time_t timeInput, tmElements_t &tm) {
+  uint32_t time = (uint32_t)timeInput;
+  tm.Second     = time % 60;
+  time /= 60;
+  tm.Minute = time % 60;
+  time /= 60;
+  tm.Hour = time % 24;
+  time /= 24;
+  tm.Wday = ((time + 4) % 7) + 1;
+
+  uint8_t year  = 0;
+  uint32_t days = 0;
+  while ((unsigned)(days += (LEAP_YEAR(year) ? 366 : 365)) <= time) {
+    year++;
+  }
+  tm.Year = year;
+  days -= LEAP_YEAR(year) ? 366 : 365;
+  time -= days;
+
+  uint8_t month = 0;
+  for (month = 0; month < 12; month++) {
+    uint8_t monthLength = monthDays[month];
+    if (month == 1 && LEAP_YEAR(year)) {
+      monthLength = 29;
+    }
+    if (time < monthLength) {
+      break;
+    }
+    time -= monthLength;
+  }
+  tm.Month = month + 1;
+  tm.Day   = time + 1;
+}
+
+time_t makeTime(const tmElements_t &tm) {
+  uint32_t seconds = tm.Year * (SECS_PER_DAY * 365);
+  for (int i = 0; i < tm.Year; i++) {
+    if (LEAP_YEAR(i)) {
+      seconds += SECS_PER_DAY;
+    }
+  }
+  for (int i = 1; i < tm.Month; i++) {
+    if (i == 2 && LEAP_YEAR(tm.Year)) {
+      seconds += SECS_PER_DAY * 29;
+    } else {
+      seconds += SECS_PER_DAY * monthDays[i - 1];
+    }
+  }
+  seconds += (tm.Day - 1) * SECS_PER_DAY;
+  seconds += tm.Hour * SECS_PER_HOUR;
+  seconds += tm.Minute * SECS_PER_MIN;
+  seconds += tm.Second;
+  return (time_t)seconds;
+}
+
+static const char *const months[] = {
+    "",     "January", "February",  "March",   "April",    "May",     "June",
+    "July", "August",  "September", "October", "November", "December"};
+
+static const char *const days[] = {
+    "", "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday",
+    "Saturday"};
+
+static char buffer[10];
+
+static char *copy(const char *str, size_t len) {
+  strncpy(buffer, str, len);
+  buffer[len < sizeof(buffer) ? len : sizeof(buffer) - 1] = 0;
+  return buffer;
+}
+
+char *monthStr(uint8_t month) {
+  return copy(months[month], sizeof(buffer) - 1);
+}
+
+char *monthShortStr(uint8_t month) { return copy(months[month], 3); }
+
+char *dayStr(uint8_t day) { return copy(days[day], sizeof(buffer) - 1); }
+
+char *dayShortStr(uint8_t day) { return copy(days[day], 3); }
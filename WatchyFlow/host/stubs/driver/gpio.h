@@ -0,0 +1,15 @@
+#pragma once
+
+#include <Arduino.h>
+
+typedef int gpio_num_t;
+
+typedef enum {
+  GPIO_INTR_LOW_LEVEL  = 4,
+  GPIO_INTR_HIGH_LEVEL = 5,
+} gpio_int_type_t;
+
+inline int gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type) {
+  return 0;
+}
+inline int gpio_wakeup_disable(gpio_num_t pin) { return 0; }
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <Arduino.h>
+
+// light sleep returns right away. waits on the panel are simulated in
+// GxEPD2_EPD::_waitWhileBusy instead.
+inline int esp_sleep_enable_gpio_wakeup() { return 0; }
+inline int esp_light_sleep_start() { return 0; }
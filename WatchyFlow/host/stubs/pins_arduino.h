@@ -0,0 +1,27 @@
+#pragma once
+
+// the Watchy V2 board variant of the ESP32 core, which config.h leaves the
+// pins to when ARDUINO_WATCHY_V20 is set.
+
+#define MENU_BTN_PIN  26
+#define BACK_BTN_PIN  25
+#define DOWN_BTN_PIN  4
+#define DISPLAY_CS    5
+#define DISPLAY_RES   9
+#define DISPLAY_DC    10
+#define DISPLAY_BUSY  19
+#define ACC_INT_1_PIN 14
+#define ACC_INT_2_PIN 12
+#define VIB_MOTOR_PIN 13
+#define RTC_INT_PIN   27
+
+#define UP_BTN_PIN   35
+#define BATT_ADC_PIN 34
+#define UP_BTN_MASK  (BIT64(35))
+#define RTC_TYPE     2 // PCF8563
+
+#define MENU_BTN_MASK (BIT64(26))
+#define BACK_BTN_MASK (BIT64(25))
+#define DOWN_BTN_MASK (BIT64(4))
+#define ACC_INT_MASK  (BIT64(14))
+#define BTN_PIN_MASK  MENU_BTN_MASK | BACK_BTN_MASK | UP_BTN_MASK | DOWN_BTN_MASK
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stdint.h>
+
+// the ESP32 ROM's little endian CRC-32.
+inline uint32_t crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len) {
+  crc = ~crc;
+  while (len-- > 0) {
+    crc ^= *buf++;
+    for (int i = 0; i < 8; i++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
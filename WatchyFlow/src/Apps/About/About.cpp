@@ -1,15 +1,47 @@
 #include "About.h"
 #include "../../Layout/Arena.h"
+#include "../../Layout/Layout.h"
+#include "../../Watchy/Energy.h"
+#include "../../Watchy/Profiler.h"
+#include "../../Watchy/WakeStub.h"
+
+#define ABOUT_PAGE_INFO    0
+#define ABOUT_PAGE_PROFILE 1
+#define ABOUT_PAGE_ENERGY  2
+#define ABOUT_PAGES        3
 
 RTC_DATA_ATTR size_t arenaUsed_;
 RTC_DATA_ATTR size_t arenaRemaining_;
+RTC_DATA_ATTR size_t arenaHeap_;
+RTC_DATA_ATTR uint32_t measureCalls_;
+RTC_DATA_ATTR uint32_t sizeCalls_;
+RTC_DATA_ATTR uint8_t aboutPage_;
+
+static const char *reasonNames[] = {"reset", "clock", "button", "usb",
+                                    "fetch"};
 
 void AboutApp::reset(Watchy *watchy) {
   arenaUsed_      = 0;
   arenaRemaining_ = 0;
+  arenaHeap_      = 0;
+  aboutPage_      = ABOUT_PAGE_INFO;
+}
+
+void AboutApp::buttonUp(Watchy *watchy) {
+  aboutPage_ = (aboutPage_ + ABOUT_PAGES - 1) % ABOUT_PAGES;
+}
+
+void AboutApp::buttonDown(Watchy *watchy) {
+  aboutPage_ = (aboutPage_ + 1) % ABOUT_PAGES;
 }
 
 AppState AboutApp::show(Watchy *watchy, Display *display, bool partialRefresh) {
+  if (aboutPage_ == ABOUT_PAGE_PROFILE) {
+    return showProfile(watchy, display, partialRefresh);
+  }
+  if (aboutPage_ == ABOUT_PAGE_ENERGY) {
+    return showEnergy(watchy, display, partialRefresh);
+  }
   display->fillScreen(GxEPD_WHITE);
   display->setTextWrap(true);
   display->setTextColor(GxEPD_BLACK);
@@ -42,7 +74,59 @@ AppState AboutApp::show(Watchy *watchy, Display *display, bool partialRefresh) {
   display->print("arena used: ");
   display->println(arenaUsed_);
   display->print("remaining:  ");
-  display->println(arenaRemaining_);
+  display->print(arenaRemaining_);
+  display->print(" heap: ");
+  display->println(arenaHeap_);
+  display->print("measures:   ");
+  display->print(sizeCalls_);
+  display->print("/");
+  display->println(measureCalls_);
+
+  const DisplayStats &stats = WatchyDisplay::stats();
+  display->print("last frame: ");
+  display->print(stats.lastFrameBytes);
+  display->print("B/");
+  display->print(stats.lastFrameWindows);
+  display->print("win/");
+  display->print(stats.lastFrameMicros);
+  display->println("us");
+  display->print("spi total:  ");
+  display->print(stats.bytesSent);
+  display->print("B/");
+  display->print(stats.windowsRefreshed);
+  display->println("ref");
+  display->print("since full: ");
+  display->print(stats.partialsSinceFull);
+  display->print("/");
+  display->print(stats.pixelsSinceFull);
+  display->println("px");
+  display->print("busy ms:    ");
+  for (uint8_t i = 0; i < REFRESH_PROFILE_COUNT; i++) {
+    display->print(stats.busyMicros[i] / 1000);
+    display->print(i + 1 < REFRESH_PROFILE_COUNT ? "/" : "\n");
+  }
+  display->print("skipped:    ");
+  display->print(stats.framesSkipped);
+  display->print("/");
+  display->println(stats.frames + stats.framesSkipped);
+
+  display->print("press ms:   ");
+  display->print(watchy->buttonLatencyMicros(false) / 1000);
+  display->print("/");
+  display->println(watchy->buttonLatencyMicros(true) / 1000);
+
+  const WiFiStats &wifi = watchy->wifiStats();
+  display->print("wifi ms:    ");
+  display->print(wifi.fastMillis);
+  display->print("/");
+  display->print(wifi.slowMillis);
+  display->print(" ");
+  display->print(wifi.fastJoins - wifi.fastFails);
+  display->print("/");
+  display->println(wifi.fastJoins);
+
+  display->print("stub skips: ");
+  display->println(WakeStub::skipped());
 
   display->print("direction:  ");
   display->println(watchy->direction());
@@ -62,9 +146,134 @@ AppState AboutApp::show(Watchy *watchy, Display *display, bool partialRefresh) {
   return APP_ACTIVE;
 }
 
+AppState AboutApp::showProfile(Watchy *watchy, Display *display,
+                               bool partialRefresh) {
+  display->fillScreen(GxEPD_WHITE);
+  display->setTextWrap(true);
+  display->setTextColor(GxEPD_BLACK);
+  display->setCursor(0, 0);
+  display->print("last ");
+  display->print(Profiler::wakes());
+  display->println(" wakes, ms");
+  display->println("phase   p50/p95/max");
+  for (uint8_t phase = 0; phase <= PROFILE_PHASE_COUNT; phase++) {
+    ProfileSummary s = Profiler::summary(phase);
+    display->printf("%-8s%lu/%lu/%lu\n",
+                    phase < PROFILE_PHASE_COUNT
+                        ? Profiler::name(ProfilePhase(phase))
+                        : "total",
+                    (unsigned long)s.p50 / 1000, (unsigned long)s.p95 / 1000,
+                    (unsigned long)s.max / 1000);
+  }
+
+  display->println("");
+  display->println("reason  n p50/p95/max");
+  for (uint8_t reason = 0; reason < sizeof(reasonNames) / sizeof(*reasonNames);
+       reason++) {
+    ProfileSummary s = Profiler::summary(PROFILE_PHASE_COUNT, reason);
+    if (s.samples == 0) {
+      continue;
+    }
+    display->printf("%-8s%u %lu/%lu/%lu\n", reasonNames[reason], s.samples,
+                    (unsigned long)s.p50 / 1000, (unsigned long)s.p95 / 1000,
+                    (unsigned long)s.max / 1000);
+  }
+
+  display->display(partialRefresh);
+
+#ifdef IS_WATCHY_V3
+  bool usb = watchy->usbPluggedIn();
+#else
+  // V2 can't tell, and writing to a port nobody listens on is harmless.
+  bool usb = true;
+#endif
+  if (usb) {
+    Serial.begin(115200);
+    Profiler::dump(Serial);
+    Serial.flush();
+  }
+  return APP_ACTIVE;
+}
+
+// largest first, leaving out what didn't use anything.
+static void printUses(Display *display, EnergyUse *uses, uint8_t count) {
+  for (uint8_t i = 1; i < count; i++) {
+    EnergyUse use = uses[i];
+    uint8_t j     = i;
+    for (; j > 0 && uses[j - 1].mah < use.mah; j--) {
+      uses[j] = uses[j - 1];
+    }
+    uses[j] = use;
+  }
+  for (uint8_t i = 0; i < count && uses[i].mah > 0; i++) {
+    display->printf("%-12s%.2f\n", uses[i].name, uses[i].mah);
+  }
+}
+
+AppState AboutApp::showEnergy(Watchy *watchy, Display *display,
+                              bool partialRefresh) {
+  display->fillScreen(GxEPD_WHITE);
+  display->setTextWrap(true);
+  display->setTextColor(GxEPD_BLACK);
+  display->setCursor(0, 0);
+  display->println("modeled mAh");
+
+  float week = 0;
+  for (uint8_t i = 0; i < Energy::DAYS; i++) {
+    week += Energy::dayMah(i);
+  }
+  display->printf("today:      %.2f\n", Energy::dayMah(0));
+  display->printf("yesterday:  %.2f\n", Energy::dayMah(1));
+  display->printf("7 days:     %.2f\n", week);
+  display->printf("total:      %.2f\n", Energy::totalMah());
+
+  float days = Energy::projectedDays();
+  display->print("runtime:    ");
+  if (days > 0) {
+    display->printf("%.1fd, %.1fd left\n", days,
+                    days * watchy->battPercent() / 100);
+  } else {
+    display->println("-");
+  }
+  display->print("battery:    ");
+  display->print(Energy::batteryMah());
+  display->println(" mAh");
+
+  display->println("");
+  display->println("by wake");
+  EnergyUse uses[Energy::REASONS + 1];
+  for (uint8_t reason = 0; reason < Energy::REASONS; reason++) {
+    uses[reason].name = reasonNames[reason];
+    uses[reason].mah  = Energy::reasonMah(reason);
+  }
+  uses[Energy::REASONS].name = "deep sleep";
+  uses[Energy::REASONS].mah  = Energy::sleepMah();
+  printUses(display, uses, Energy::REASONS + 1);
+
+  display->println("");
+  display->println("by app");
+  EnergyUse apps[Energy::APPS];
+  uint8_t appCount = Energy::apps();
+  for (uint8_t i = 0; i < appCount; i++) {
+    apps[i] = Energy::app(i);
+  }
+  printUses(display, apps, appCount);
+
+  display->display(partialRefresh);
+  return APP_ACTIVE;
+}
+
 void AboutApp::presleep() {
-  if (globalArena.used() > arenaUsed_) {
-    arenaUsed_      = globalArena.used();
-    arenaRemaining_ = globalArena.remaining();
+  if (globalArena.highWater() > arenaUsed_) {
+    arenaUsed_      = globalArena.highWater();
+    arenaRemaining_ = globalArena.remaining() + globalArena.used() - arenaUsed_;
+  }
+  if (globalArena.heapHighWater() > arenaHeap_) {
+    arenaHeap_ = globalArena.heapHighWater();
+  }
+  if (LayoutElement::measureCalls > 0) {
+    // from the last wake that laid anything out
+    measureCalls_ = LayoutElement::measureCalls;
+    sizeCalls_    = LayoutElement::sizeCalls;
   }
 }
@@ -6,6 +6,13 @@ class AboutApp : public WatchyApp {
 public:
   void reset(Watchy *watchy) override;
   AppState show(Watchy *watchy, Display *display, bool partialRefresh) override;
+  void buttonUp(Watchy *watchy) override;
+  void buttonDown(Watchy *watchy) override;
+  const char *name() override { return "about"; }
 
   static void presleep();
+
+private:
+  AppState showProfile(Watchy *watchy, Display *display, bool partialRefresh);
+  AppState showEnergy(Watchy *watchy, Display *display, bool partialRefresh);
 };
@@ -1,17 +1,11 @@
 #include "AltApp.h"
 
 AppState AltApp::show(Watchy *watchy, Display *display, bool partialRefresh) {
-  if (fullDrawNeeded_) {
-    partialRefresh = false;
-  }
-  fullDrawNeeded_ = false;
-
   if (memory_->altApp) {
     if (alt_->show(watchy, display, partialRefresh) == APP_ACTIVE) {
       return APP_ACTIVE;
     }
     memory_->altApp = false;
-    partialRefresh  = false;
   }
   return main_->show(watchy, display, partialRefresh);
 }
@@ -42,11 +36,9 @@ AppState AltApp::buttonSelect(Watchy *watchy) {
   if (memory_->altApp) {
     if (alt_->buttonSelect(watchy) != APP_ACTIVE) {
       memory_->altApp = false;
-      fullDrawNeeded_ = true;
     }
   } else {
     memory_->altApp = true;
-    fullDrawNeeded_ = true;
   }
   return APP_ACTIVE;
 }
@@ -55,9 +47,14 @@ AppState AltApp::buttonBack(Watchy *watchy) {
   if (memory_->altApp) {
     if (alt_->buttonBack(watchy) != APP_ACTIVE) {
       memory_->altApp = false;
-      fullDrawNeeded_ = true;
     }
     return APP_ACTIVE;
   }
   return main_->buttonBack(watchy);
 }
+
+time_t AltApp::nextWakeup(Watchy *watchy) {
+  return (memory_->altApp ? alt_ : main_)->nextWakeup(watchy);
+}
+
+const char *AltApp::name() { return (memory_->altApp ? alt_ : main_)->name(); }
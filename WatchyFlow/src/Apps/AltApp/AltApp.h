@@ -9,7 +9,7 @@ typedef struct altAppMemory {
 class AltApp : public WatchyApp {
 public:
   AltApp(altAppMemory *memory, WatchyApp *main, WatchyApp *alt)
-      : memory_(memory), main_(main), alt_(alt), fullDrawNeeded_(false) {}
+      : memory_(memory), main_(main), alt_(alt) {}
 
   AppState show(Watchy *watchy, Display *display, bool partialRefresh) override;
   FetchState fetchNetwork(Watchy *watchy) override;
@@ -19,10 +19,11 @@ public:
   void buttonDown(Watchy *watchy) override;
   AppState buttonSelect(Watchy *watchy) override;
   AppState buttonBack(Watchy *watchy) override;
+  time_t nextWakeup(Watchy *watchy) override;
+  const char *name() override;
 
 private:
   altAppMemory *memory_;
   WatchyApp *main_;
   WatchyApp *alt_;
-  bool fullDrawNeeded_;
 };
@@ -1,5 +1,6 @@
 #include "Calendar.h"
 #include "../../Layout/Layout.h"
+#include "../../Layout/FontMetrics.h"
 #include "../../Watchy/Watchy.h"
 #include <Fonts/Picopixel.h>
 
@@ -58,6 +59,96 @@ void addAlarm(alarmsData *data, String summary, time_t start) {
   data->alarmCount++;
 }
 
+void notifyStarts(Watchy *watchy, eventsData *columns, uint8_t columnCount,
+                  int32_t offsetSeconds, alarmsData *alarms) {
+  if (watchy->wakeupReason() != WAKEUP_CLOCK) {
+    return;
+  }
+  tmElements_t currentTime = watchy->localtime();
+  time_t now               = watchy->unixtime();
+
+  time_t windowStart = now + offsetSeconds - CALENDAR_PAST_SECONDS;
+  if (!watchy->quietHours()) {
+    for (int c = 0; c < columnCount; c++) {
+      for (int i = 0; i < columns[c].eventCount; i++) {
+        eventData *event = &(columns[c].events[i]);
+        if (event->end <= windowStart) {
+          continue;
+        }
+        tmElements_t eventStarttm = watchy->toLocalTime(event->start);
+        if (eventStarttm.Minute == currentTime.Minute &&
+            eventStarttm.Hour == currentTime.Hour &&
+            eventStarttm.Day == currentTime.Day) {
+          watchy->vibrate(75, 5);
+        }
+      }
+    }
+  }
+
+  for (int i = 0; i < alarms->alarmCount; i++) {
+    alarmData *alarm = &(alarms->alarms[i]);
+    if (alarm->start < now - (2 * 60) || alarm->start > now + (60 * 60)) {
+      continue;
+    }
+    tmElements_t alarmtm = watchy->toLocalTime(alarm->start);
+    if (alarmtm.Minute == currentTime.Minute &&
+        alarmtm.Hour == currentTime.Hour) {
+      watchy->vibrate(100, 10);
+    }
+  }
+}
+
+time_t nextAlarm(alarmsData *alarms, time_t after) {
+  time_t next = 0;
+  for (int i = 0; i < alarms->alarmCount; i++) {
+    // it goes off during the minute it starts in.
+    time_t start = alarms->alarms[i].start;
+    start -= start % 60;
+    if (start > after && (next == 0 || start < next)) {
+      next = start;
+    }
+  }
+  return next;
+}
+
+static uint32_t mix(uint32_t state, uint32_t value) {
+  return (state ^ value) * 16777619u;
+}
+
+uint32_t scheduleState(Watchy *watchy, dayEventsData *day, eventsData *columns,
+                       uint8_t columnCount, int32_t offsetSeconds) {
+  time_t drawnTime   = watchy->unixtime() + offsetSeconds;
+  time_t windowStart = drawnTime - CALENDAR_PAST_SECONDS;
+  // no column is taller than the screen.
+  time_t windowEnd = windowStart + WatchyDisplay::HEIGHT * SECONDS_PER_PIXEL;
+
+  // hours are whole pixels, so they move along with the window.
+  uint32_t state = mix(2166136261u, windowStart / SECONDS_PER_PIXEL);
+  for (int i = 0; i < day->eventCount; i++) {
+    bool shown = day->events[i].start <= drawnTime &&
+                 day->events[i].end > drawnTime;
+    state = mix(state, shown);
+  }
+  for (int c = 0; c < columnCount; c++) {
+    for (int i = 0; i < columns[c].eventCount; i++) {
+      time_t eventStart = columns[c].events[i].start;
+      time_t eventEnd   = columns[c].events[i].end;
+      if (eventEnd - eventStart < SMALLEST_EVENT) {
+        eventEnd = eventStart + SMALLEST_EVENT;
+      }
+      if (eventEnd <= windowStart || eventStart >= windowEnd) {
+        continue;
+      }
+      if (eventStart < windowStart) {
+        eventStart = windowStart;
+      }
+      state = mix(state, (eventStart - windowStart) / SECONDS_PER_PIXEL);
+      state = mix(state, (eventEnd - windowStart) / SECONDS_PER_PIXEL);
+    }
+  }
+  return state;
+}
+
 void CalendarDayEvents::maybeDraw(Display *display, int16_t x0, int16_t y0,
                                   uint16_t targetWidth, uint16_t targetHeight,
                                   uint16_t *width, uint16_t *height,
@@ -79,7 +170,8 @@ void CalendarDayEvents::maybeDraw(Display *display, int16_t x0, int16_t y0,
 
     uint16_t textWidth, textHeight;
     int16_t x1, y1;
-    display->getTextBounds(text, 0, 0, &x1, &y1, &textWidth, &textHeight);
+    FontMetrics(SMALL_FONT)
+        .bounds(text.c_str(), &x1, &y1, &textWidth, &textHeight);
     textWidth += EVENT_PADDING * 2;
     textHeight += EVENT_PADDING;
     if (textWidth > *width) {
@@ -176,10 +268,9 @@ void CalendarColumn::draw(Display *display, int16_t x0, int16_t y0,
   display->setFont(SMALL_FONT);
   display->setTextColor(color_);
 
-  tmElements_t currentTime = watchy_->localtime();
-  time_t windowOffset      = watchy_->unixtime() + offset_;
-  time_t windowStart       = windowOffset - CALENDAR_PAST_SECONDS;
-  time_t windowEnd         = windowStart + (targetHeight * SECONDS_PER_PIXEL);
+  time_t windowOffset = watchy_->unixtime() + offset_;
+  time_t windowStart  = windowOffset - CALENDAR_PAST_SECONDS;
+  time_t windowEnd    = windowStart + (targetHeight * SECONDS_PER_PIXEL);
 
   for (int i = 0; i < data_->eventCount; i++) {
     eventData *event  = &(data_->events[i]);
@@ -192,16 +283,6 @@ void CalendarColumn::draw(Display *display, int16_t x0, int16_t y0,
       continue;
     }
 
-    tmElements_t eventStarttm = watchy_->toLocalTime(eventStart);
-    if (eventStarttm.Minute == currentTime.Minute &&
-        eventStarttm.Hour == currentTime.Hour &&
-        eventStarttm.Day == currentTime.Day &&
-        watchy_->wakeupReason() == WAKEUP_CLOCK &&
-        // TODO: configurable
-        currentTime.Hour >= 6 && currentTime.Hour < 22) {
-      watchy_->vibrate(75, 5);
-    }
-
     if (eventEnd - eventStart < SMALLEST_EVENT) {
       eventEnd = eventStart + SMALLEST_EVENT;
     }
@@ -230,7 +311,7 @@ void CalendarColumn::draw(Display *display, int16_t x0, int16_t y0,
     }
     int16_t x1, y1;
     uint16_t tw, th;
-    display->getTextBounds(event->summary, 0, 0, &x1, &y1, &tw, &th);
+    FontMetrics(SMALL_FONT).bounds(event->summary, &x1, &y1, &tw, &th);
     if (tw + (EVENT_PADDING * 2) > targetWidth ||
         th + (EVENT_PADDING * 2) > eventSize) {
       resizeText(display, event->summary, MAX_EVENT_NAME_LEN,
@@ -249,30 +330,18 @@ void CalendarColumn::draw(Display *display, int16_t x0, int16_t y0,
 void CalendarColumn::resizeText(Display *display, char *text, uint8_t buflen,
                                 uint16_t width, uint16_t height, int16_t *x1,
                                 int16_t *y1, uint16_t *tw, uint16_t *th) {
-  String original = text;
-  String result;
-  int i = 0;
-  while (true) {
-    if (i >= original.length()) {
-      break;
-    }
-    display->getTextBounds(result + original[i], 0, 0, x1, y1, tw, th);
-    if (*tw > width) {
-      // TODO: newlines aren't handled by the display library
-      // in a way where the x offset is reset to the offset of
-      // the previous line. instead, the x offset is reset to
-      // the left of the screen! that means this approach won't
-      // work here, and we will need to have the caller of
-      // resize text find newlines and reset the cursor x
-      // position or something. for now, just disable
-      // subsequent lines.
-      break;
-    }
-    result += original[i];
-    i++;
+  // TODO: newlines aren't handled by the display library in a way where the
+  // x offset is reset to the offset of the previous line. instead, the x
+  // offset is reset to the left of the screen! that means this approach won't
+  // work here, and we will need to have the caller of resize text find
+  // newlines and reset the cursor x position or something. for now, just
+  // disable subsequent lines.
+  FontMetrics metrics(SMALL_FONT);
+  size_t fits = metrics.fit(text, width);
+  if (fits < buflen) {
+    text[fits] = '\0';
   }
-  result.toCharArray(text, buflen);
-  display->getTextBounds(result, 0, 0, x1, y1, tw, th);
+  metrics.bounds(text, x1, y1, tw, th);
 }
 
 void CalendarHourBar::maybeDraw(Display *display, int16_t x0, int16_t y0,
@@ -314,7 +383,7 @@ void CalendarHourBar::maybeDraw(Display *display, int16_t x0, int16_t y0,
     text += hourNum;
     int16_t x1, y1;
     uint16_t tw, th;
-    display->getTextBounds(text, 0, 0, &x1, &y1, &tw, &th);
+    FontMetrics(SMALL_FONT).bounds(text.c_str(), &x1, &y1, &tw, &th);
     if ((th + 3) * SECONDS_PER_PIXEL + hourTime > windowEnd) {
       continue;
     }
@@ -353,9 +422,8 @@ void CalendarHourBar::maybeDraw(Display *display, int16_t x0, int16_t y0,
 void CalendarAlarms::maybeDraw(Display *display, int16_t x0, int16_t y0,
                                uint16_t targetWidth, uint16_t targetHeight,
                                uint16_t *width, uint16_t *height, bool noop) {
-  *width                   = targetWidth;
-  *height                  = 0;
-  tmElements_t currentTime = watchy_->localtime();
+  *width  = targetWidth;
+  *height = 0;
 
   display->setFont(NULL);
   display->setTextColor(color_);
@@ -372,11 +440,6 @@ void CalendarAlarms::maybeDraw(Display *display, int16_t x0, int16_t y0,
       continue;
     }
     tmElements_t alarmtm = watchy_->toLocalTime(alarm->start);
-    if (!noop && alarmtm.Minute == currentTime.Minute &&
-        alarmtm.Hour == currentTime.Hour &&
-        watchy_->wakeupReason() == WAKEUP_CLOCK) {
-      watchy_->vibrate(100, 10);
-    }
     String text;
     int hourNum = ((alarmtm.Hour + 11) % 12) + 1;
     if (hourNum < 10) {
@@ -390,7 +453,7 @@ void CalendarAlarms::maybeDraw(Display *display, int16_t x0, int16_t y0,
 
     int16_t x1, y1;
     uint16_t tw, th;
-    display->getTextBounds(text, 0, 0, &x1, &y1, &tw, &th);
+    FontMetrics(NULL).bounds(text.c_str(), &x1, &y1, &tw, &th);
 
     if (!noop) {
       display->setCursor(x0 - x1 + EVENT_PADDING,
@@ -40,6 +40,20 @@ void addEvent(dayEventsData *data, String summary, time_t start, time_t end);
 void addEvent(eventsData *data, String summary, time_t start, time_t end);
 void addAlarm(alarmsData *data, String summary, time_t start);
 
+// buzzes for alarms, and events in the schedule columns scrolled to
+// offsetSeconds, that start this minute. the calendar isn't necessarily
+// redrawn every minute, so this isn't done while drawing.
+void notifyStarts(Watchy *watchy, eventsData *columns, uint8_t columnCount,
+                  int32_t offsetSeconds, alarmsData *alarms);
+// the start of the minute the first alarm after the given time goes off in,
+// or 0 if there is none.
+time_t nextAlarm(alarmsData *alarms, time_t after);
+// changes whenever the schedule scrolled to offsetSeconds would be drawn
+// differently: an event or the hour marks move down a pixel, or an all day
+// event starts or ends.
+uint32_t scheduleState(Watchy *watchy, dayEventsData *day, eventsData *columns,
+                       uint8_t columnCount, int32_t offsetSeconds);
+
 class CalendarDayEvents : public LayoutElement {
 public:
   CalendarDayEvents(dayEventsData *data, Watchy *watchy, int32_t offsetSeconds,
@@ -60,7 +74,7 @@ public:
   }
 
   LayoutElement::ptr clone() const override {
-    return std::make_shared<CalendarDayEvents>(*this);
+    return new CalendarDayEvents(*this);
   }
 
 private:
@@ -94,9 +108,7 @@ public:
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override;
 
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<CalendarMonth>(*this);
-  }
+  LayoutElement::ptr clone() const override { return new CalendarMonth(*this); }
 
 private:
   dayEventsData *data_;
@@ -125,7 +137,7 @@ public:
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override;
 
   LayoutElement::ptr clone() const override {
-    return std::make_shared<CalendarColumn>(*this);
+    return new CalendarColumn(*this);
   }
 
 private:
@@ -157,7 +169,7 @@ public:
   }
 
   LayoutElement::ptr clone() const override {
-    return std::make_shared<CalendarHourBar>(*this);
+    return new CalendarHourBar(*this);
   }
 
 private:
@@ -188,7 +200,7 @@ public:
   }
 
   LayoutElement::ptr clone() const override {
-    return std::make_shared<CalendarAlarms>(*this);
+    return new CalendarAlarms(*this);
   }
 
 private:
@@ -4,10 +4,12 @@
 #include <Arduino_JSON.h>
 #include <Fonts/Picopixel.h>
 #include "../../Layout/Layout.h"
+#include "../../Layout/Invalidation.h"
 #include "../../Elements/Battery.h"
 #include "Calendar.h"
 #include "../../Elements/Weather.h"
 #include "../../Fonts/Seven_Segment10pt7b.h"
+#include "../../Fonts/Seven_Segment10pt7b_columns.h"
 #include "../../Fonts/DSEG7_Classic_Bold_25.h"
 #include "../../Fonts/DSEG7_Classic_Regular_39.h"
 #include "icons.h"
@@ -33,6 +35,23 @@ RTC_DATA_ATTR int32_t monthEventOffset;
 RTC_DATA_ATTR bool viewShowAboveCalendar;
 RTC_DATA_ATTR bool monthView;
 RTC_DATA_ATTR bool monthDayAbs;
+// bumped whenever the events or alarms change.
+RTC_DATA_ATTR uint32_t calendarVersion;
+
+// what the face's widgets read, for Invalidation.
+typedef enum CalendarInput {
+  FACE_TIME     = 0, // hour and minute
+  FACE_STEPS    = 1,
+  FACE_BATTERY  = 2, // voltage and charge bucket
+  FACE_WEATHER  = 3, // temperature and condition
+  FACE_DATE     = 4, // the day the schedule shows
+  FACE_CALENDAR = 5, // calendarVersion
+  FACE_SCROLL   = 6, // schedule or event list offsets
+  FACE_SCHEDULE = 7, // scheduleState
+  FACE_STATUS   = 8, // fetch error or age
+} CalendarInput;
+
+#define READS(input) (1 << (input))
 
 void zeroError() {
   for (int i = 0; i < (sizeof(calendarError) / sizeof(calendarError[0])); i++) {
@@ -52,6 +71,7 @@ void CalendarFace::reset(Watchy *watchy) {
   monthView             = false;
   monthDayAbs           = false;
   monthEventOffset      = 0;
+  calendarVersion++;
   zeroError();
 }
 
@@ -128,6 +148,7 @@ void CalendarFace::parseCalendar(Watchy *watchy, String payload) {
   }
   ::reset(&calendarDay);
   ::reset(&alarms);
+  calendarVersion++;
 
   JSONVar events = parsed["events"];
   for (int i = 0; i < events.length(); i++) {
@@ -192,8 +213,10 @@ String secondsToReadable(time_t val) {
 
 AppState CalendarFace::show(Watchy *watchy, Display *display,
                             bool partialRefresh) {
-  display->fillScreen(BACKGROUND_COLOR);
+  ArenaScope frame(globalArena);
   display->setTextWrap(false);
+  // the date runs up the left edge.
+  display->addFontColumns(&Seven_Segment10pt7b, &Seven_Segment10pt7bColumns);
   tmElements_t currentTime = watchy->localtime();
 
   uint16_t color = FOREGROUND_COLOR;
@@ -230,6 +253,7 @@ AppState CalendarFace::show(Watchy *watchy, Display *display,
   if (offsetTime.Day < 10) {
     dayOfMonthStr = String("0") + dayOfMonthStr;
   }
+  String dateStr = dayOfWeekStr + " " + monthStr + " " + dayOfMonthStr;
 
   String errorMessage = calendarError;
   if (errorMessage.length() == 0) {
@@ -239,6 +263,31 @@ AppState CalendarFace::show(Watchy *watchy, Display *display,
     }
   }
 
+  uint32_t stepCount = watchy->stepCounter();
+  String voltageStr  = String(watchy->battVoltage());
+
+  notifyStarts(watchy, calendar, monthView ? 0 : activeCalendarColumns,
+               dayScheduleOffset, &alarms);
+
+  Invalidation changes(this, viewShowAboveCalendar | (monthView << 1));
+  changes.set(FACE_TIME, timeStr);
+  changes.set(FACE_STEPS, stepCount);
+  changes.set(FACE_BATTERY, voltageStr + "/" +
+                                String(int(26 * watchy->battPercent() / 100)));
+  changes.set(FACE_WEATHER, tempStr + (weatherUpToDate ? " " : "!") +
+                                String(weatherConditionCode));
+  changes.set(FACE_DATE, dateStr);
+  changes.set(FACE_CALENDAR, calendarVersion);
+  changes.set(FACE_SCROLL, String(dayScheduleOffset) + "/" +
+                               String(monthEventOffset) + "/" +
+                               String(monthDayAbs ? 1 : 0));
+  if (!monthView) {
+    changes.set(FACE_SCHEDULE,
+                scheduleState(watchy, &calendarDay, calendar,
+                              activeCalendarColumns, dayScheduleOffset));
+  }
+  changes.set(FACE_STATUS, errorMessage);
+
   LayoutCell elemTempOrWiFi;
   if (weatherUpToDate) {
     elemTempOrWiFi.set(LayoutText(tempStr, &Seven_Segment10pt7b, color));
@@ -249,50 +298,60 @@ AppState CalendarFace::show(Watchy *watchy, Display *display,
   LayoutCell elemTop;
   if (viewShowAboveCalendar) {
     elemTop.set(LayoutRows({
-        LayoutEntry(LayoutColumns({
-            LayoutEntry(LayoutVCenter(LayoutBitmap(steps, 19, 23, color))),
-            LayoutEntry(LayoutSpacer(5)),
-            LayoutEntry(LayoutVCenter(LayoutText(String(watchy->stepCounter()),
-                                                 &Seven_Segment10pt7b, color))),
-            LayoutEntry(LayoutFill(), true),
-            LayoutEntry(LayoutVCenter(LayoutText(String(watchy->battVoltage()),
-                                                 &Seven_Segment10pt7b, color))),
-            LayoutEntry(LayoutSpacer(5)),
-            LayoutEntry(LayoutVCenter(LayoutBattery(watchy, color))),
-        })),
+        LayoutEntry(LayoutDepends(
+            &changes, READS(FACE_STEPS) | READS(FACE_BATTERY),
+            LayoutColumns({
+                LayoutEntry(LayoutVCenter(LayoutBitmap(steps, 19, 23, color))),
+                LayoutEntry(LayoutSpacer(5)),
+                LayoutEntry(LayoutVCenter(LayoutText(
+                    String(stepCount), &Seven_Segment10pt7b, color))),
+                LayoutEntry(LayoutFill(), true),
+                LayoutEntry(LayoutVCenter(
+                    LayoutText(voltageStr, &Seven_Segment10pt7b, color))),
+                LayoutEntry(LayoutSpacer(5)),
+                LayoutEntry(LayoutVCenter(LayoutBattery(watchy, color))),
+            }))),
         LayoutEntry(LayoutSpacer(5)),
-        LayoutEntry(LayoutColumns({
-            LayoutEntry(LayoutSpacer(5)),
+        LayoutEntry(LayoutDepends(
+            &changes, READS(FACE_TIME) | READS(FACE_WEATHER),
+            LayoutColumns({
+                LayoutEntry(LayoutSpacer(5)),
+                LayoutEntry(LayoutVCenter(
+                    LayoutText(timeStr, &DSEG7_Classic_Regular_39, color))),
+                LayoutEntry(LayoutSpacer(5)),
+                LayoutEntry(LayoutFill(), true),
+                LayoutEntry(LayoutVCenter(
+                    LayoutText(tempStr, &Seven_Segment10pt7b, color))),
+                LayoutEntry(LayoutSpacer(5)),
+                LayoutEntry(LayoutVCenter(LayoutWeatherIcon(
+                    weatherUpToDate, weatherConditionCode, color))),
+            }))),
+    }));
+  } else {
+    elemTop.set(LayoutDepends(
+        &changes,
+        READS(FACE_TIME) | READS(FACE_WEATHER) | READS(FACE_BATTERY),
+        LayoutColumns({
             LayoutEntry(LayoutVCenter(
-                LayoutText(timeStr, &DSEG7_Classic_Regular_39, color))),
-            LayoutEntry(LayoutSpacer(5)),
+                LayoutText(timeStr, &DSEG7_Classic_Bold_25, color))),
             LayoutEntry(LayoutFill(), true),
-            LayoutEntry(LayoutVCenter(
-                LayoutText(tempStr, &Seven_Segment10pt7b, color))),
+            LayoutEntry(LayoutVCenter(elemTempOrWiFi)),
             LayoutEntry(LayoutSpacer(5)),
-            LayoutEntry(LayoutVCenter(LayoutWeatherIcon(
-                weatherUpToDate, weatherConditionCode, color))),
-        })),
-    }));
-  } else {
-    elemTop.set(LayoutColumns({
-        LayoutEntry(
-            LayoutVCenter(LayoutText(timeStr, &DSEG7_Classic_Bold_25, color))),
-        LayoutEntry(LayoutFill(), true),
-        LayoutEntry(LayoutVCenter(elemTempOrWiFi)),
-        LayoutEntry(LayoutSpacer(5)),
-        LayoutEntry(LayoutVCenter(LayoutBattery(watchy, color))),
-    }));
+            LayoutEntry(LayoutVCenter(LayoutBattery(watchy, color))),
+        })));
   }
 
-  LayoutBottomAlign elemError(LayoutRightAlign(LayoutBackground(
-      LayoutPad(LayoutText(errorMessage, &Picopixel, color), 2, 2, 2, 2),
-      BACKGROUND_COLOR)));
-
   LayoutCell elemCalendar;
   if (monthView) {
-    elemCalendar.set(CalendarMonth(&calendarDay, watchy, monthEventOffset,
-                                   !monthDayAbs, color));
+    // day counts go down as the events get closer.
+    uint16_t reads = READS(FACE_CALENDAR) | READS(FACE_SCROLL);
+    if (!monthDayAbs) {
+      reads |= READS(FACE_TIME);
+    }
+    elemCalendar.set(
+        LayoutDepends(&changes, reads,
+                      CalendarMonth(&calendarDay, watchy, monthEventOffset,
+                                    !monthDayAbs, color)));
   } else {
     std::vector<LayoutEntry, MemArenaAllocator<LayoutEntry>> calColumns(
         allocatorLayoutEntry);
@@ -304,39 +363,47 @@ AppState CalendarFace::show(Watchy *watchy, Display *display,
           CalendarColumn(&calendar[i], watchy, dayScheduleOffset, color),
           true));
     }
-    elemCalendar.set(LayoutRows({
-        LayoutEntry(
-            CalendarDayEvents(&calendarDay, watchy, dayScheduleOffset, color)),
-        LayoutEntry(LayoutColumns(calColumns), true),
-    }));
+    elemCalendar.set(LayoutDepends(
+        &changes,
+        READS(FACE_CALENDAR) | READS(FACE_SCROLL) | READS(FACE_SCHEDULE),
+        LayoutRows({
+            LayoutEntry(CalendarDayEvents(&calendarDay, watchy,
+                                          dayScheduleOffset, color)),
+            LayoutEntry(LayoutColumns(calColumns), true),
+        })));
   }
 
-  uint16_t w, h;
-  LayoutRows({
-                 LayoutEntry(elemTop),
-                 LayoutEntry(LayoutSpacer(5)),
-                 LayoutEntry(
-                     LayoutColumns({
-                         LayoutEntry(LayoutRows({
-                             LayoutEntry(LayoutRotate(
-                                 LayoutText(dayOfWeekStr + " " + monthStr +
-                                                " " + dayOfMonthStr,
-                                            &Seven_Segment10pt7b, color),
-                                 3)),
-                             LayoutEntry(LayoutFill(), true),
-                         })),
-                         LayoutEntry(LayoutSpacer(5)),
-                         LayoutEntry(LayoutBorder(
-                                         LayoutOverlay(elemCalendar, elemError),
-                                         true, false, true, true, color),
-                                     true),
-                     }),
-                     true),
-                 LayoutEntry(CalendarAlarms(&alarms, watchy, color)),
-             })
-      .draw(display, 0, 0, display->width(), display->height(), &w, &h);
-
-  display->display(partialRefresh);
+  LayoutBottomAlign elemError(LayoutRightAlign(LayoutDepends(
+      &changes, READS(FACE_STATUS),
+      LayoutBackground(
+          LayoutPad(LayoutText(errorMessage, &Picopixel, color), 2, 2, 2, 2),
+          BACKGROUND_COLOR))));
+
+  LayoutRows root({
+      LayoutEntry(elemTop),
+      LayoutEntry(LayoutSpacer(5)),
+      LayoutEntry(
+          LayoutColumns({
+              LayoutEntry(LayoutRows({
+                  LayoutEntry(LayoutDepends(
+                      &changes, READS(FACE_DATE),
+                      LayoutRotate(
+                          LayoutText(dateStr, &Seven_Segment10pt7b, color),
+                          3))),
+                  LayoutEntry(LayoutFill(), true),
+              })),
+              LayoutEntry(LayoutSpacer(5)),
+              LayoutEntry(LayoutBorder(LayoutOverlay(elemCalendar, elemError),
+                                       true, false, true, true, color),
+                          true),
+          }),
+          true),
+      LayoutEntry(LayoutDepends(&changes,
+                                READS(FACE_TIME) | READS(FACE_CALENDAR),
+                                CalendarAlarms(&alarms, watchy, color))),
+  });
+
+  changes.show(display, root, BACKGROUND_COLOR, partialRefresh);
 
   if (currentTime.Hour == 0 && currentTime.Minute == 0) {
     watchy->resetStepCounter();
@@ -345,6 +412,19 @@ AppState CalendarFace::show(Watchy *watchy, Display *display,
   return APP_ACTIVE;
 }
 
+time_t CalendarFace::nextWakeup(Watchy *watchy) {
+  if (!watchy->quietHours()) {
+    return watchy->nextMinute();
+  }
+  // the time is left alone, but alarms still go off.
+  time_t next  = watchy->nextHour();
+  time_t alarm = nextAlarm(&alarms, watchy->unixtime());
+  if (alarm != 0 && alarm < next) {
+    next = alarm;
+  }
+  return next;
+}
+
 void CalendarFace::buttonDown(Watchy *watchy) {
   if (monthView) {
     monthDayAbs = !monthDayAbs;
@@ -21,6 +21,8 @@ public:
   void buttonUp(Watchy *watchy) override;
   void buttonDown(Watchy *watchy) override;
   AppState buttonBack(Watchy *watchy) override;
+  time_t nextWakeup(Watchy *watchy) override;
+  const char *name() override { return "calendar"; }
 
   void forceCacheMiss() { forceCacheMiss_ = true; }
 
@@ -16,8 +16,7 @@ MemArenaAllocator<MenuItem> allocatorMenuItem(globalArena);
 
 MenuApp::MenuApp(menuAppMemory *memory, const char *title,
                  std::initializer_list<MenuItem> elems)
-    : memory_(memory), title_(title), items_(allocatorMenuItem),
-      fullDrawNeeded_(false) {
+    : memory_(memory), title_(title), items_(allocatorMenuItem) {
   items_.reserve(elems.size());
   for (const MenuItem &info : elems) {
     items_.push_back(info);
@@ -25,11 +24,6 @@ MenuApp::MenuApp(menuAppMemory *memory, const char *title,
 }
 
 AppState MenuApp::show(Watchy *watchy, Display *display, bool partialRefresh) {
-  if (fullDrawNeeded_) {
-    partialRefresh = false;
-  }
-  fullDrawNeeded_ = false;
-
   uint16_t index = memory_->index % items_.size();
 
   if (memory_->inApp) {
@@ -68,6 +62,7 @@ void MenuApp::buttonUp(Watchy *watchy) {
     return;
   }
   memory_->index = (memory_->index + items_.size() - 1) % items_.size();
+  cursorMoved_   = true;
 }
 
 void MenuApp::buttonDown(Watchy *watchy) {
@@ -76,19 +71,18 @@ void MenuApp::buttonDown(Watchy *watchy) {
     return;
   }
   memory_->index = (memory_->index + 1) % items_.size();
+  cursorMoved_   = true;
 }
 
 AppState MenuApp::buttonSelect(Watchy *watchy) {
   uint16_t index = memory_->index % items_.size();
   if (memory_->inApp) {
     if (items_[index].app_->buttonSelect(watchy) != APP_ACTIVE) {
-      memory_->inApp  = false;
-      fullDrawNeeded_ = true;
+      memory_->inApp = false;
     }
     return APP_ACTIVE;
   }
-  memory_->inApp  = true;
-  fullDrawNeeded_ = true;
+  memory_->inApp = true;
   return APP_ACTIVE;
 }
 
@@ -96,15 +90,30 @@ AppState MenuApp::buttonBack(Watchy *watchy) {
   uint16_t index = memory_->index % items_.size();
   if (memory_->inApp) {
     if (items_[index].app_->buttonBack(watchy) != APP_ACTIVE) {
-      memory_->inApp  = false;
-      fullDrawNeeded_ = true;
+      memory_->inApp = false;
     }
     return APP_ACTIVE;
   }
   return APP_EXIT;
 }
 
+time_t MenuApp::nextWakeup(Watchy *watchy) {
+  if (memory_->inApp) {
+    return items_[memory_->index % items_.size()].app_->nextWakeup(watchy);
+  }
+  // nothing on the menu changes over time.
+  return watchy->nextHour();
+}
+
+const char *MenuApp::name() {
+  if (memory_->inApp) {
+    return items_[memory_->index % items_.size()].app_->name();
+  }
+  return title_;
+}
+
 void MenuApp::showMenu(Watchy *watchy, Display *display, bool partialRefresh) {
+  ArenaScope frame(globalArena);
   display->fillScreen(BACKGROUND_COLOR);
   display->setTextWrap(false);
 
@@ -136,5 +145,10 @@ void MenuApp::showMenu(Watchy *watchy, Display *display, bool partialRefresh) {
   LayoutButtonLabels(watchy, "Back", "Select", "->", "<-", NULL,
                      FOREGROUND_COLOR, true, LayoutRows(menu))
       .draw(display, 0, 0, display->width(), display->height(), &w, &h);
+  if (cursorMoved_) {
+    // only the highlight moved, so latency beats ghosting here.
+    display->setRefreshProfile(REFRESH_FAST);
+    cursorMoved_ = false;
+  }
   display->display(partialRefresh);
 }
@@ -29,8 +29,7 @@ public:
           std::initializer_list<MenuItem> elems);
   MenuApp(menuAppMemory *memory, const char *title,
           std::vector<MenuItem, MemArenaAllocator<MenuItem>> elems)
-      : memory_(memory), title_(title), items_(std::move(elems)),
-        fullDrawNeeded_(false) {}
+      : memory_(memory), title_(title), items_(std::move(elems)) {}
 
   AppState show(Watchy *watchy, Display *display, bool partialRefresh) override;
   FetchState fetchNetwork(Watchy *watchy) override;
@@ -40,6 +39,8 @@ public:
   void buttonDown(Watchy *watchy) override;
   AppState buttonSelect(Watchy *watchy) override;
   AppState buttonBack(Watchy *watchy) override;
+  time_t nextWakeup(Watchy *watchy) override;
+  const char *name() override;
 
 private:
   void showMenu(Watchy *watchy, Display *display, bool partialRefresh);
@@ -48,5 +49,5 @@ private:
   menuAppMemory *memory_;
   const char *title_;
   std::vector<MenuItem, MemArenaAllocator<MenuItem>> items_;
-  bool fullDrawNeeded_;
+  bool cursorMoved_ = false;
 };
@@ -1,5 +1,6 @@
 #include "Stopwatch.h"
 #include "../../Layout/Layout.h"
+#include "../../Layout/Static.h"
 #include "../../Elements/Buttons.h"
 #include "../../Fonts/DSEG7_Classic_Regular_39.h"
 #include "../../Fonts/Seven_Segment10pt7b.h"
@@ -41,6 +42,7 @@ String durationToString(time_t total) {
 
 AppState StopwatchApp::show(Watchy *watchy, Display *display,
                             bool partialRefresh) {
+  ArenaScope frame(globalArena);
   display->fillScreen(BACKGROUND_COLOR);
   display->setTextWrap(false);
 
@@ -52,27 +54,33 @@ AppState StopwatchApp::show(Watchy *watchy, Display *display,
   String time  = durationToString(total);
   String split = durationToString(split_);
 
+  auto face = Static::vcenter(Static::rows(
+      Static::hcenter(
+          Static::text(split.c_str(), &Seven_Segment10pt7b, FOREGROUND_COLOR)),
+      Static::spacer<5>(),
+      Static::hcenter(Static::text(time.c_str(), &DSEG7_Classic_Regular_39,
+                                   FOREGROUND_COLOR)),
+      Static::spacer<5>(),
+      Static::hcenter(Static::text(running_ ? "Running..." : "Stopped",
+                                   &FreeSans9pt7b, FOREGROUND_COLOR))));
+
   uint16_t w, h;
-  LayoutButtonLabels(
-      watchy, "Back", running_ ? "Stop" : "Start", "Split",
-      running_ ? "Refresh" : "Reset", NULL, FOREGROUND_COLOR, false,
-      LayoutVCenter(LayoutRows({
-          LayoutEntry(LayoutHCenter(
-              LayoutText(split, &Seven_Segment10pt7b, FOREGROUND_COLOR))),
-          LayoutEntry(LayoutSpacer(5)),
-          LayoutEntry(LayoutHCenter(
-              LayoutText(time, &DSEG7_Classic_Regular_39, FOREGROUND_COLOR))),
-          LayoutEntry(LayoutSpacer(5)),
-          LayoutEntry(
-              LayoutHCenter(LayoutText(running_ ? "Running..." : "Stopped",
-                                       &FreeSans9pt7b, FOREGROUND_COLOR))),
-      })))
+  LayoutButtonLabels(watchy, "Back", running_ ? "Stop" : "Start", "Split",
+                     running_ ? "Refresh" : "Reset", NULL, FOREGROUND_COLOR,
+                     false, layoutStatic(face))
       .draw(display, 0, 0, display->width(), display->height(), &w, &h);
 
+  // only digits change between frames, so latency beats ghosting here.
+  display->setRefreshProfile(REFRESH_FAST);
   display->display(partialRefresh);
   return APP_ACTIVE;
 }
 
+time_t StopwatchApp::nextWakeup(Watchy *watchy) {
+  // a running stopwatch keeps counting through the quiet hours.
+  return running_ ? watchy->nextMinute() : watchy->nextHour();
+}
+
 void StopwatchApp::buttonUp(Watchy *watchy) {
   time_t total = elapsed_;
   if (running_) {
@@ -11,4 +11,6 @@ public:
   virtual void buttonDown(Watchy *watchy) override;
   virtual AppState buttonSelect(Watchy *watchy) override;
   virtual AppState buttonBack(Watchy *watchy) override;
+  virtual time_t nextWakeup(Watchy *watchy) override;
+  virtual const char *name() override { return "stopwatch"; }
 };
@@ -16,9 +16,7 @@ public:
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override;
 
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutBattery>(*this);
-  }
+  LayoutElement::ptr clone() const override { return new LayoutBattery(*this); }
 
 private:
   Watchy *watchy_;
@@ -11,12 +11,13 @@ public:
 
   void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
             uint16_t *width, uint16_t *height) override {
-    layout_->size(display, targetWidth, targetHeight, width, height);
+    layout_->measure(display, targetWidth, targetHeight, width, height);
   }
 
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override {
-    layout_->draw(display, x0, y0, targetWidth, targetHeight, width, height);
+    layout_->drawClipped(display, x0, y0, targetWidth, targetHeight, width,
+                         height);
   }
 
   LayoutElement::ptr clone() const override { return layout_; }
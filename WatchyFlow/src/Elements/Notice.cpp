@@ -0,0 +1,16 @@
+#include "Notice.h"
+#include "../Layout/Static.h"
+
+void showNotice(Display *display, const char *msg) {
+  auto notice = Static::background(
+      Static::border<true, true, true, true>(
+          Static::pad<3, 3, 3, 3>(Static::text(msg, NULL, GxEPD_BLACK)),
+          GxEPD_BLACK),
+      GxEPD_WHITE);
+
+  uint16_t w, h;
+  notice.size(display, 0, 0, &w, &h);
+  notice.draw(display, display->width() - w - 3, display->height() - h - 3, 0,
+              0, &w, &h);
+  display->display(true);
+}
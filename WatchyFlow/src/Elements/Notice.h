@@ -0,0 +1,14 @@
+#pragma once
+
+#include "../Watchy/Watchy.h"
+
+// draws msg boxed in the bottom right corner, over whatever the buffer holds,
+// and shows it with a partial refresh. the buffer has to hold the whole frame
+// the panel shows, see Display::drawWholeFrames.
+void showNotice(Display *display, const char *msg);
+
+// whether a wake shows notices while it fetches. clock wakes fetch quietly,
+// so one that finds nothing new leaves the panel alone.
+inline bool showsNotices(WakeupReason wakeup) {
+  return wakeup != WAKEUP_CLOCK;
+}
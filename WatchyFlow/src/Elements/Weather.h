@@ -18,7 +18,7 @@ public:
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override;
 
   LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutWeatherIcon>(*this);
+    return new LayoutWeatherIcon(*this);
   }
 
 private:
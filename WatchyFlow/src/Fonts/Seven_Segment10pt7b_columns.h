@@ -0,0 +1,137 @@
+#pragma once
+
+// generated by font_columns.py from Seven_Segment10pt7b.h, do not edit.
+// pass to Display::addFontColumns together with Seven_Segment10pt7b.
+
+#include "../Watchy/Framebuffer.h"
+
+const uint8_t Seven_Segment10pt7bColumnBitmaps[] PROGMEM = {
+    0x00, 0xFF, 0xFC, 0x80, 0x00, 0x80, 0x14, 0x00, 0x15, 0x80, 0x17, 0x00,
+    0x3C, 0x00, 0xF7, 0x80, 0x1E, 0x00, 0x74, 0x00, 0xD4, 0x00, 0x14, 0x00,
+    0x1F, 0x00, 0x00, 0x20, 0x81, 0x00, 0x20, 0x81, 0x00, 0xE0, 0x81, 0xC0,
+    0x20, 0x81, 0x00, 0x20, 0x81, 0x00, 0x20, 0x81, 0x00, 0x00, 0x7E, 0x00,
+    0x1C, 0x00, 0x22, 0x00, 0x22, 0x0C, 0x22, 0x18, 0x1C, 0x60, 0x01, 0xC0,
+    0x07, 0x00, 0x0C, 0x00, 0x30, 0xE0, 0xC1, 0x10, 0x01, 0x10, 0x00, 0xE0,
+    0x7D, 0xF8, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04,
+    0x82, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFC, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x02, 0x04,
+    0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0xFF, 0xFC, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04,
+    0x80, 0x04, 0xFF, 0xFC, 0x7F, 0xF8, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04,
+    0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x7F, 0xF8,
+    0x2C, 0x38, 0xFE, 0x38, 0x2C, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0xFB, 0xE0, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04,
+    0x00, 0x04, 0x00, 0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x04, 0x00, 0x18, 0x00, 0x70, 0x00, 0xC0, 0x02, 0x00, 0x0E, 0x00, 0x38,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x80, 0x04, 0x80, 0x04, 0x80,
+    0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x7F, 0xF8, 0xFF, 0xFC, 0x01,
+    0xF8, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82,
+    0x04, 0x7C, 0x00, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82,
+    0x04, 0x7D, 0xF8, 0xFC, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02,
+    0x00, 0x02, 0x00, 0x02, 0x00, 0xFD, 0xFC, 0x7C, 0x00, 0x82, 0x04, 0x82,
+    0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x01, 0xF8, 0x7D,
+    0xF8, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82,
+    0x04, 0x01, 0xF8, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x7F, 0xFC, 0x7D, 0xF8, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82,
+    0x04, 0x82, 0x04, 0x82, 0x04, 0x7D, 0xF8, 0x7C, 0x00, 0x82, 0x04, 0x82,
+    0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x7D, 0xF8, 0xCC,
+    0xFF, 0xFC, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0xFF, 0xFC,
+    0x07, 0x80, 0x38, 0x70, 0xC0, 0x0C, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0xC0, 0x0C, 0x38, 0x70, 0x07, 0x80, 0x00, 0xFC, 0x81,
+    0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x7E,
+    0x00, 0x7E, 0xF8, 0x80, 0x04, 0x80, 0x04, 0x87, 0xC4, 0x88, 0x24, 0x88,
+    0x24, 0x88, 0x24, 0x7E, 0xC0, 0x7E, 0xFC, 0x81, 0x00, 0x81, 0x00, 0x81,
+    0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x7E, 0xFC, 0x7D, 0xF8, 0x82,
+    0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x7D,
+    0xF8, 0x7F, 0xF8, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80,
+    0x04, 0x7F, 0xF8, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80,
+    0x04, 0x80, 0x04, 0x7F, 0xF8, 0x7D, 0xF8, 0x82, 0x04, 0x82, 0x04, 0x82,
+    0x04, 0x82, 0x04, 0x82, 0x04, 0x7D, 0xFC, 0x82, 0x00, 0x82, 0x00, 0x82,
+    0x00, 0x82, 0x00, 0x82, 0x00, 0x7D, 0xF8, 0x80, 0x04, 0x82, 0x04, 0x82,
+    0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x01, 0xF8, 0xFE, 0xFC, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFE,
+    0xFC, 0xFF, 0xFC, 0x01, 0xF8, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0xFF, 0xF8, 0xFD, 0xFC, 0x02, 0x00, 0x0E,
+    0x00, 0x1A, 0x00, 0x32, 0x00, 0x62, 0x00, 0x42, 0x00, 0x81, 0xFC, 0xFF,
+    0xF8, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x7F,
+    0xFC, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x7E, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x7F, 0xFC, 0x7F, 0xFC, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x7F,
+    0xFC, 0x7F, 0xF8, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80,
+    0x04, 0x80, 0x04, 0x7F, 0xF8, 0x7D, 0xFC, 0x82, 0x00, 0x82, 0x00, 0x82,
+    0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x7C, 0x00, 0x7F, 0xF8, 0x80,
+    0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x0C, 0x7F,
+    0xFC, 0x7D, 0xFC, 0x82, 0x00, 0x82, 0x80, 0x82, 0xC0, 0x82, 0x60, 0x82,
+    0x30, 0x82, 0x18, 0x7C, 0x04, 0x7C, 0x00, 0x82, 0x04, 0x82, 0x04, 0x82,
+    0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x01, 0xF8, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x7F, 0xFC, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0xFF, 0xF8, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0xFF, 0xF8, 0xFF, 0x80, 0x00, 0x70, 0x00,
+    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x70, 0xFF, 0x80, 0xFF,
+    0xF8, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x01, 0xF8, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0xFF, 0xF8, 0xC0, 0x0C, 0x70,
+    0x38, 0x1C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xE0, 0x70, 0x38, 0xC0,
+    0x0C, 0xFC, 0x00, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02,
+    0x04, 0x02, 0x04, 0xFD, 0xF8, 0x80, 0x00, 0x80, 0x3C, 0x80, 0xE4, 0x81,
+    0x84, 0x86, 0x04, 0x9C, 0x04, 0xF0, 0x04, 0x00, 0x04, 0x7F, 0xF8, 0x80,
+    0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0xC0, 0x00, 0x60, 0x00, 0x18,
+    0x00, 0x0E, 0x00, 0x00, 0x80, 0x00, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00,
+    0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x7F, 0xF8, 0x20,
+    0x20, 0x40, 0x40, 0x40, 0x80, 0x80, 0x00, 0x80, 0xC0, 0x40, 0x40, 0x60,
+    0x20, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0xFC, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0xFF, 0xFC, 0x7E,
+    0xFC, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81,
+    0x00, 0x7E, 0xFC, 0x7D, 0xF8, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82,
+    0x04, 0x82, 0x04, 0x82, 0x04, 0x7D, 0xF8, 0x7F, 0xF8, 0x80, 0x04, 0x80,
+    0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x7F, 0xF8, 0x80, 0x04, 0x80,
+    0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x7F, 0xF8, 0x7D,
+    0xF8, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x7D,
+    0xFC, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x7D,
+    0xF8, 0x80, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82,
+    0x04, 0x01, 0xF8, 0xFE, 0xFC, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0xFE, 0xFC, 0xFF, 0xFC, 0x01, 0xF8, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0xFF,
+    0xF8, 0xFD, 0xFC, 0x02, 0x00, 0x0E, 0x00, 0x1A, 0x00, 0x32, 0x00, 0x62,
+    0x00, 0x42, 0x00, 0x81, 0xFC, 0xFF, 0xF8, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x7F, 0xFC, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x7E, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x7F, 0xFC, 0x7F, 0xFC, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x7F, 0xFC, 0x7F, 0xF8, 0x80, 0x04, 0x80,
+    0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x7F, 0xF8, 0x7D,
+    0xFC, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82, 0x00, 0x82,
+    0x00, 0x7C, 0x00, 0x7F, 0xF8, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80,
+    0x04, 0x80, 0x04, 0x80, 0x0C, 0x7F, 0xFC, 0x7D, 0xFC, 0x82, 0x00, 0x82,
+    0x80, 0x82, 0xC0, 0x82, 0x60, 0x82, 0x30, 0x82, 0x18, 0x7C, 0x04, 0x7C,
+    0x00, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82,
+    0x04, 0x01, 0xF8, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x7F,
+    0xFC, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xFF, 0xF8, 0x00,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0xFF,
+    0xF8, 0xFF, 0x80, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x00, 0x70, 0xFF, 0x80, 0xFF, 0xF8, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0x00, 0x04, 0x01, 0xF8, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00,
+    0x04, 0xFF, 0xF8, 0xC0, 0x0C, 0x70, 0x38, 0x1C, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x1C, 0xE0, 0x70, 0x38, 0xC0, 0x0C, 0xFC, 0x00, 0x02, 0x04, 0x02,
+    0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0xFD, 0xF8, 0x80,
+    0x00, 0x80, 0x3C, 0x80, 0xE4, 0x81, 0x84, 0x86, 0x04, 0x9C, 0x04, 0xF0,
+    0x04, 0x00, 0x04, 0x01, 0x00, 0x01, 0x00, 0x7E, 0xF8, 0x80, 0x04, 0x80,
+    0x04, 0x80, 0x04, 0x80, 0x04, 0xFF, 0xFF, 0x80, 0x04, 0x80, 0x04, 0x80,
+    0x04, 0x80, 0x04, 0x7E, 0xF8, 0x01, 0x00, 0x01, 0x00, 0xFF, 0xFC, 0x80,
+    0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0xFF, 0xFC};
+
+const uint16_t Seven_Segment10pt7bColumnOffsets[] PROGMEM = {
+    0, 1, 3, 6, 24, 48, 72, 160, 172, 182,
+    192, 197, 219, 221, 226, 227, 245, 261, 263, 279,
+    291, 307, 323, 339, 351, 367, 383, 384, 396, 402,
+    411, 417, 433, 449, 465, 481, 493, 509, 521, 533,
+    549, 565, 567, 583, 599, 611, 633, 649, 665, 681,
+    697, 713, 729, 747, 763, 779, 801, 817, 833, 849,
+    859, 877, 887, 901, 911, 923, 939, 955, 967, 983,
+    995, 1007, 1023, 1039, 1041, 1057, 1073, 1085, 1107, 1123,
+    1139, 1155, 1171, 1187, 1203, 1221, 1237, 1253, 1275, 1291,
+    1307, 1323, 1337, 1339, 1353};
+
+const FontColumns Seven_Segment10pt7bColumns PROGMEM = {
+    Seven_Segment10pt7bColumnBitmaps, Seven_Segment10pt7bColumnOffsets, 95};
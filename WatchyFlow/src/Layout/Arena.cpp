@@ -1,9 +1,11 @@
 #include "Arena.h"
 
-MemArena::MemArena(size_t size) : size_(size) {
+MemArena::MemArena(size_t size)
+    : size_(size), heapBlocks_(nullptr), heapUsed_(0), heapPeak_(0) {
   begin_   = static_cast<char *>(::operator new(size));
   end_     = begin_ + size;
   current_ = begin_;
+  peak_    = begin_;
 }
 
 MemArena::~MemArena() {
@@ -12,20 +14,76 @@ MemArena::~MemArena() {
 }
 
 void *MemArena::allocate(size_t requested, size_t alignment) {
+  void *ptr = tryAllocate(requested, alignment);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void *MemArena::tryAllocate(size_t requested, size_t alignment) noexcept {
   void *current = current_;
   size_t space  = end_ - current_;
 
   if (!std::align(alignment, requested, current, space) ||
       static_cast<char *>(current) + requested > end_) {
-    throw std::bad_alloc();
+    return allocateHeap(requested, alignment);
   }
 
   current_ = static_cast<char *>(current) + requested;
+  if (current_ > peak_) {
+    peak_ = current_;
+  }
   return current;
 }
 
+void *MemArena::allocateHeap(size_t requested, size_t alignment) noexcept {
+  size_t size      = sizeof(HeapBlock) + alignment + requested;
+  HeapBlock *block = static_cast<HeapBlock *>(malloc(size));
+  if (block == nullptr) {
+    return nullptr;
+  }
+  block->next = heapBlocks_;
+  block->size = size;
+  heapBlocks_ = block;
+
+  heapUsed_ += size;
+  if (heapUsed_ > heapPeak_) {
+    heapPeak_ = heapUsed_;
+  }
+
+  void *current = block + 1;
+  size_t space  = alignment + requested;
+  return std::align(alignment, requested, current, space);
+}
+
 void MemArena::deallocate(void *ptr, size_t size) noexcept {
-  // deliberately disabled
+  // deliberately disabled, memory is reclaimed by ArenaScope.
+}
+
+ArenaScope::ArenaScope(MemArena &arena)
+    : arena_(&arena), mark_(arena.current_), outerPeak_(arena.peak_),
+      heapMark_(arena.heapBlocks_), heapUsedMark_(arena.heapUsed_),
+      outerHeapPeak_(arena.heapPeak_) {
+  arena.peak_     = arena.current_;
+  arena.heapPeak_ = arena.heapUsed_;
+}
+
+ArenaScope::~ArenaScope() {
+  while (arena_->heapBlocks_ != heapMark_) {
+    MemArena::HeapBlock *block = arena_->heapBlocks_;
+    arena_->heapBlocks_        = block->next;
+
+    arena_->heapUsed_ -= block->size;
+    free(block);
+  }
+  arena_->current_ = mark_;
+  if (outerPeak_ > arena_->peak_) {
+    arena_->peak_ = outerPeak_;
+  }
+  if (outerHeapPeak_ > arena_->heapPeak_) {
+    arena_->heapPeak_ = outerHeapPeak_;
+  }
 }
 
 MemArena globalArena(16 * 1024);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdlib>
 #include <memory>
 #include <stdexcept>
 
@@ -12,21 +13,68 @@ public:
 
   ~MemArena();
 
+  // once the arena is full, allocations fall back to the heap. those blocks
+  // are freed when the ArenaScope they were made in ends. allocate throws
+  // std::bad_alloc only if the heap is exhausted too, tryAllocate returns
+  // nullptr instead.
   void *allocate(size_t requested, size_t alignment);
+  void *tryAllocate(size_t requested, size_t alignment) noexcept;
   void deallocate(void *ptr, size_t size) noexcept;
 
   size_t used() { return current_ - begin_; }
   size_t remaining() { return end_ - current_; }
+  size_t highWater() { return peak_ - begin_; }
+  size_t heapUsed() { return heapUsed_; }
+  size_t heapHighWater() { return heapPeak_; }
+
+  friend class ArenaScope;
+
+private:
+  typedef struct HeapBlock {
+    HeapBlock *next;
+    size_t size;
+  } HeapBlock;
+
+  void *allocateHeap(size_t requested, size_t alignment) noexcept;
 
 private:
   size_t size_;
   char *begin_;
   char *end_;
   char *current_;
+  char *peak_;
+  HeapBlock *heapBlocks_;
+  size_t heapUsed_;
+  size_t heapPeak_;
 };
 
 extern MemArena globalArena;
 
+// ArenaScope marks the arena on construction and rewinds it to that mark on
+// destruction, so everything allocated in between has to be dead by then.
+// scopes nest, e.g. one per rendered frame.
+class ArenaScope {
+public:
+  explicit ArenaScope(MemArena &arena);
+  ~ArenaScope();
+
+  ArenaScope(const ArenaScope &)            = delete;
+  ArenaScope &operator=(const ArenaScope &) = delete;
+
+  // the most arena bytes used at once since the scope started.
+  size_t highWater() { return arena_->peak_ - mark_; }
+  // the same for the heap blocks allocated once the arena was full.
+  size_t heapHighWater() { return arena_->heapPeak_ - heapUsedMark_; }
+
+private:
+  MemArena *arena_;
+  char *mark_;
+  char *outerPeak_;
+  MemArena::HeapBlock *heapMark_;
+  size_t heapUsedMark_;
+  size_t outerHeapPeak_;
+};
+
 template <typename T> class MemArenaAllocator {
 public:
   using value_type = T;
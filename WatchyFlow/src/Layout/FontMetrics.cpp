@@ -0,0 +1,123 @@
+#include "FontMetrics.h"
+
+// the built-in font is 5x7 in a 6x8 cell.
+static const uint8_t CLASSIC_ADVANCE = 6;
+static const uint8_t CLASSIC_HEIGHT  = 8;
+
+uint8_t FontMetrics::advance(char c) const {
+  if (c == '\n' || c == '\r') {
+    return 0;
+  }
+  if (font_ == NULL) {
+    return CLASSIC_ADVANCE;
+  }
+  uint8_t u = (uint8_t)c;
+  if (u < font_->first || u > font_->last) {
+    return 0;
+  }
+  return font_->glyph[u - font_->first].xAdvance;
+}
+
+void FontMetrics::start(Extent *e) const {
+  e->x    = 0;
+  e->y    = 0;
+  e->minx = 0x7FFF;
+  e->miny = 0x7FFF;
+  e->maxx = -1;
+  e->maxy = -1;
+}
+
+// the same steps as Adafruit_GFX::charBounds.
+void FontMetrics::add(Extent *e, char c) const {
+  if (c == '\r') {
+    return;
+  }
+  if (font_ == NULL) {
+    if (c == '\n') {
+      e->x = 0;
+      e->y += CLASSIC_HEIGHT;
+      return;
+    }
+    int16_t x2 = e->x + CLASSIC_ADVANCE - 1;
+    int16_t y2 = e->y + CLASSIC_HEIGHT - 1;
+    if (x2 > e->maxx) {
+      e->maxx = x2;
+    }
+    if (y2 > e->maxy) {
+      e->maxy = y2;
+    }
+    if (e->x < e->minx) {
+      e->minx = e->x;
+    }
+    if (e->y < e->miny) {
+      e->miny = e->y;
+    }
+    e->x += CLASSIC_ADVANCE;
+    return;
+  }
+
+  if (c == '\n') {
+    e->x = 0;
+    e->y += font_->yAdvance;
+    return;
+  }
+  uint8_t u = (uint8_t)c;
+  if (u < font_->first || u > font_->last) {
+    return;
+  }
+  // font tables are const data in flash, which the ESP32 reads directly.
+  const GFXglyph *glyph = &font_->glyph[u - font_->first];
+  int16_t x1            = e->x + glyph->xOffset;
+  int16_t y1            = e->y + glyph->yOffset;
+  int16_t x2            = x1 + glyph->width - 1;
+  int16_t y2            = y1 + glyph->height - 1;
+  if (x1 < e->minx) {
+    e->minx = x1;
+  }
+  if (y1 < e->miny) {
+    e->miny = y1;
+  }
+  if (x2 > e->maxx) {
+    e->maxx = x2;
+  }
+  if (y2 > e->maxy) {
+    e->maxy = y2;
+  }
+  e->x += glyph->xAdvance;
+}
+
+void FontMetrics::bounds(const char *text, size_t len, int16_t *x1,
+                         int16_t *y1, uint16_t *width,
+                         uint16_t *height) const {
+  Extent e;
+  start(&e);
+  for (size_t i = 0; i < len; i++) {
+    add(&e, text[i]);
+  }
+
+  *x1     = 0;
+  *y1     = 0;
+  *width  = 0;
+  *height = 0;
+  if (e.maxx >= e.minx) {
+    *x1    = e.minx;
+    *width = e.maxx - e.minx + 1;
+  }
+  if (e.maxy >= e.miny) {
+    *y1     = e.miny;
+    *height = e.maxy - e.miny + 1;
+  }
+}
+
+size_t FontMetrics::fit(const char *text, uint16_t maxWidth) const {
+  Extent e;
+  start(&e);
+  size_t i = 0;
+  for (; text[i] != '\0'; i++) {
+    add(&e, text[i]);
+    if (e.maxx >= e.minx && e.maxx - e.minx + 1 > maxWidth) {
+      break;
+    }
+  }
+  return i;
+}
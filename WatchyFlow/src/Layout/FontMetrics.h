@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Adafruit_GFX.h>
+
+// text measurement straight from a font's glyph table, without going through
+// the display. results match Adafruit_GFX::getTextBounds at (0, 0) with text
+// size 1 and wrapping off, for GFX fonts and for the built-in 6x8 font (NULL).
+class FontMetrics {
+public:
+  explicit FontMetrics(const GFXfont *font) : font_(font) {}
+
+  // how far the cursor moves for c.
+  uint8_t advance(char c) const;
+
+  void bounds(const char *text, int16_t *x1, int16_t *y1, uint16_t *width,
+              uint16_t *height) const {
+    bounds(text, strlen(text), x1, y1, width, height);
+  }
+  void bounds(const char *text, size_t len, int16_t *x1, int16_t *y1,
+              uint16_t *width, uint16_t *height) const;
+
+  // the length of the longest prefix of text whose bounds are at most
+  // maxWidth wide. a prefix is never narrower than a shorter one, so this is
+  // a single pass that stops at the first character that doesn't fit.
+  size_t fit(const char *text, uint16_t maxWidth) const;
+
+private:
+  typedef struct Extent {
+    int16_t x, y;
+    int16_t minx, miny, maxx, maxy;
+  } Extent;
+
+  void start(Extent *e) const;
+  void add(Extent *e, char c) const;
+
+  const GFXfont *font_;
+};
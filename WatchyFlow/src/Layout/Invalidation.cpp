@@ -0,0 +1,199 @@
+#include "Invalidation.h"
+
+typedef struct InvalidationState {
+  const void *owner;
+  uint32_t layout;
+  uint32_t frames; // WatchyDisplay::stats().frames once the frame was sent
+  uint8_t widgets;
+  uint32_t inputs[Invalidation::MAX_INPUTS];
+  uint16_t reads[Invalidation::MAX_WIDGETS];
+  Invalidation::Box boxes[Invalidation::MAX_WIDGETS];
+} InvalidationState;
+
+RTC_DATA_ATTR InvalidationState lastFrame;
+
+static bool sameBox(const Invalidation::Box &a, const Invalidation::Box &b) {
+  return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+// the panel tiles a box touches.
+static uint64_t tilesOf(const Invalidation::Box &box) {
+  int16_t x1 = box.x, y1 = box.y;
+  int16_t x2 = box.x + box.w - 1, y2 = box.y + box.h - 1;
+  if (x1 < 0)
+    x1 = 0;
+  if (y1 < 0)
+    y1 = 0;
+  if (x2 >= int16_t(WatchyDisplay::WIDTH))
+    x2 = WatchyDisplay::WIDTH - 1;
+  if (y2 >= int16_t(WatchyDisplay::HEIGHT))
+    y2 = WatchyDisplay::HEIGHT - 1;
+  if (box.w == 0 || box.h == 0 || x2 < x1 || y2 < y1) {
+    return 0;
+  }
+  uint64_t tiles = 0;
+  for (int16_t row = y1 / WatchyDisplay::TILE_HEIGHT;
+       row <= y2 / WatchyDisplay::TILE_HEIGHT; row++) {
+    for (int16_t column = x1 / WatchyDisplay::TILE_WIDTH;
+         column <= x2 / WatchyDisplay::TILE_WIDTH; column++) {
+      tiles |= 1ULL << (row * WatchyDisplay::TILE_COLUMNS + column);
+    }
+  }
+  return tiles;
+}
+
+// the bounding box of some tiles.
+static Invalidation::Box tileBounds(uint64_t tiles) {
+  int16_t x1 = WatchyDisplay::WIDTH, y1 = WatchyDisplay::HEIGHT, x2 = 0, y2 = 0;
+  for (uint16_t i = 0; i < WatchyDisplay::TILE_COUNT; i++) {
+    if (((tiles >> i) & 1) == 0) {
+      continue;
+    }
+    int16_t x = (i % WatchyDisplay::TILE_COLUMNS) * WatchyDisplay::TILE_WIDTH;
+    int16_t y = (i / WatchyDisplay::TILE_COLUMNS) * WatchyDisplay::TILE_HEIGHT;
+    if (x < x1)
+      x1 = x;
+    if (y < y1)
+      y1 = y;
+    if (x + WatchyDisplay::TILE_WIDTH > x2)
+      x2 = x + WatchyDisplay::TILE_WIDTH;
+    if (y + WatchyDisplay::TILE_HEIGHT > y2)
+      y2 = y + WatchyDisplay::TILE_HEIGHT;
+  }
+  Invalidation::Box box = {x1, y1, uint16_t(x2 - x1), uint16_t(y2 - y1)};
+  return box;
+}
+
+void Invalidation::set(uint8_t input, uint32_t value) {
+  if (input < MAX_INPUTS) {
+    inputs_[input] = value;
+  }
+}
+
+void Invalidation::set(uint8_t input, const String &value) {
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < value.length(); i++) {
+    hash = (hash ^ (uint8_t)value[i]) * 16777619u;
+  }
+  set(input, hash);
+}
+
+uint8_t Invalidation::add(uint16_t inputs) {
+  if (widgets_ >= MAX_WIDGETS) {
+    // can't be tracked, so every frame is drawn whole.
+    overflow_ = true;
+    return NO_WIDGET;
+  }
+  reads_[widgets_] = inputs;
+  return widgets_++;
+}
+
+void Invalidation::show(Display *display, LayoutElement &root,
+                        uint16_t background, bool partialRefresh) {
+  bool reuse = !overflow_ && lastFrame.owner == owner_ &&
+               lastFrame.layout == layout_ && lastFrame.widgets == widgets_ &&
+               lastFrame.frames == WatchyDisplay::stats().frames &&
+               display->getRotation() == 0 && !display->clipped() &&
+               !display->fullRefresh(partialRefresh) &&
+               !display->drawsWholeFrames() &&
+               display->epd2.frameKnown();
+  if (!reuse || !drawChanged(display, root, background)) {
+    drawAll(display, root, background);
+  }
+
+  display->display(partialRefresh);
+
+  lastFrame.owner   = overflow_ ? nullptr : owner_;
+  lastFrame.layout  = layout_;
+  lastFrame.frames  = WatchyDisplay::stats().frames;
+  lastFrame.widgets = widgets_;
+  memcpy(lastFrame.inputs, inputs_, sizeof(inputs_));
+  memcpy(lastFrame.reads, reads_, sizeof(reads_));
+  memcpy(lastFrame.boxes, boxes_, sizeof(boxes_));
+}
+
+bool Invalidation::drawChanged(Display *display, LayoutElement &root,
+                               uint16_t background) {
+  uint16_t changed = 0;
+  for (uint8_t i = 0; i < MAX_INPUTS; i++) {
+    if (inputs_[i] != lastFrame.inputs[i]) {
+      changed |= 1 << i;
+    }
+  }
+
+  dirty_ = 0;
+  tiles_ = 0;
+  for (uint8_t i = 0; i < widgets_; i++) {
+    if (reads_[i] != lastFrame.reads[i]) {
+      return false;
+    }
+    boxes_[i] = lastFrame.boxes[i];
+    if (reads_[i] & changed) {
+      dirty_ |= 1 << i;
+      tiles_ |= tilesOf(boxes_[i]);
+    }
+  }
+  if (dirty_ == 0) {
+    // the panel already shows this frame.
+    display->epd2.limitNextFrame(0);
+    return true;
+  }
+
+  // the buffer starts out empty, so the layout is drawn as usual but widgets
+  // that didn't change are skipped unless they share a tile with one that
+  // did. only those tiles are sent, the panel keeps the rest.
+  partial_  = true;
+  conflict_ = false;
+  uint16_t w, h;
+  display->fillScreen(background);
+  root.draw(display, 0, 0, display->width(), display->height(), &w, &h);
+  partial_ = false;
+  if (conflict_) {
+    return false;
+  }
+  display->epd2.limitNextFrame(tiles_);
+  return true;
+}
+
+void Invalidation::drawAll(Display *display, LayoutElement &root,
+                           uint16_t background) {
+  memset(boxes_, 0, sizeof(boxes_));
+  uint16_t w, h;
+  display->fillScreen(background);
+  root.draw(display, 0, 0, display->width(), display->height(), &w, &h);
+}
+
+void Invalidation::drawWidget(uint8_t widget, LayoutElement *child,
+                              Display *display, int16_t x0, int16_t y0,
+                              uint16_t targetWidth, uint16_t targetHeight,
+                              uint16_t *width, uint16_t *height) {
+  child->measure(display, targetWidth, targetHeight, width, height);
+  Box box = {x0, y0, *width, *height};
+  if (!partial_) {
+    if (widget != NO_WIDGET) {
+      boxes_[widget] = box;
+    }
+    child->draw(display, x0, y0, targetWidth, targetHeight, width, height);
+    return;
+  }
+
+  if (!sameBox(box, boxes_[widget])) {
+    // whatever it covered before would have to be drawn again too.
+    conflict_ = true;
+    return;
+  }
+  if (dirty_ & (1 << widget)) {
+    child->draw(display, x0, y0, targetWidth, targetHeight, width, height);
+    return;
+  }
+  uint64_t shared = tiles_ & tilesOf(box);
+  if (shared == 0) {
+    // still on the panel.
+    return;
+  }
+  Box area = tileBounds(shared);
+  display->setClip(area.x, area.y, area.w, area.h);
+  child->draw(display, x0, y0, targetWidth, targetHeight, width, height);
+  display->clearClip();
+}
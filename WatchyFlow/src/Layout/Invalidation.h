@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Layout.h"
+
+// redraws only the widgets whose inputs changed since the last frame. a face
+// numbers the inputs its widgets read (the minute, the step count, ...), sets
+// their values for this frame and wraps each widget in LayoutDepends with the
+// inputs it reads. everything that isn't wrapped has to look the same on
+// every frame.
+//
+// the inputs and where each widget landed are kept in RTC memory. the frame
+// buffer doesn't survive deep sleep, but the panel keeps showing the last
+// frame, so only the tiles around changed widgets are drawn and sent. if a
+// widget moved or changed size, anything else was shown since, or the display
+// asks for whole frames, the frame is drawn and sent whole as before.
+//
+// the frame has to be drawn unrotated, and widgets can't be nested.
+class Invalidation {
+public:
+  static const uint8_t MAX_INPUTS  = 16;
+  static const uint8_t MAX_WIDGETS = 12;
+
+  // owner and layout say what is drawn. a frame is only reused by the same
+  // owner with the same layout.
+  Invalidation(const void *owner, uint32_t layout)
+      : owner_(owner), layout_(layout) {}
+
+  void set(uint8_t input, uint32_t value);
+  void set(uint8_t input, const String &value);
+
+  // draws root over the whole screen on background and displays it.
+  void show(Display *display, LayoutElement &root, uint16_t background,
+            bool partialRefresh);
+
+  // for LayoutDepends. add numbers widgets in the order they are built.
+  uint8_t add(uint16_t inputs);
+  void drawWidget(uint8_t widget, LayoutElement *child, Display *display,
+                  int16_t x0, int16_t y0, uint16_t targetWidth,
+                  uint16_t targetHeight, uint16_t *width, uint16_t *height);
+
+  static const uint8_t NO_WIDGET = 0xFF;
+
+  typedef struct Box {
+    int16_t x, y;
+    uint16_t w, h;
+  } Box;
+
+private:
+  bool drawChanged(Display *display, LayoutElement &root, uint16_t background);
+  void drawAll(Display *display, LayoutElement &root, uint16_t background);
+
+  const void *owner_;
+  uint32_t layout_;
+  uint32_t inputs_[MAX_INPUTS] = {};
+  uint16_t reads_[MAX_WIDGETS] = {};
+  Box boxes_[MAX_WIDGETS]      = {};
+  uint8_t widgets_             = 0;
+  bool overflow_               = false;
+
+  // while only the changed widgets are drawn
+  bool partial_   = false;
+  bool conflict_  = false;
+  uint16_t dirty_ = 0;  // widgets whose inputs changed
+  uint64_t tiles_ = 0;  // tiles that are drawn and sent
+};
+
+// a widget of an Invalidation frame, redrawn when one of inputs changes.
+// inputs has bit i set for input i.
+class LayoutDepends : public LayoutElement {
+public:
+  LayoutDepends(Invalidation *frame, uint16_t inputs,
+                const LayoutElement &child)
+      : frame_(frame), widget_(frame->add(inputs)), child_(child.clone()) {}
+  LayoutDepends(const LayoutDepends &copy)
+      : frame_(copy.frame_), widget_(copy.widget_), child_(copy.child_) {}
+
+  void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
+            uint16_t *width, uint16_t *height) override {
+    child_->measure(display, targetWidth, targetHeight, width, height);
+  }
+
+  void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
+            uint16_t targetHeight, uint16_t *width, uint16_t *height) override {
+    frame_->drawWidget(widget_, child_, display, x0, y0, targetWidth,
+                       targetHeight, width, height);
+  }
+
+  LayoutElement::ptr clone() const override { return new LayoutDepends(*this); }
+
+private:
+  Invalidation *frame_;
+  uint8_t widget_;
+  LayoutElement::ptr child_;
+};
@@ -1,4 +1,5 @@
 #include "Layout.h"
+#include "FontMetrics.h"
 
 static void *LayoutElement::operator new(size_t size) {
   return globalArena.allocate(size, alignof(LayoutElement));
@@ -19,30 +20,76 @@ static void LayoutElement::operator delete[](void *ptr) noexcept {
   globalArena.deallocate(ptr, -1);
 }
 
+uint32_t LayoutElement::measureCalls = 0;
+uint32_t LayoutElement::sizeCalls    = 0;
+
+void LayoutElement::measure(Display *display, uint16_t targetWidth,
+                            uint16_t targetHeight, uint16_t *width,
+                            uint16_t *height) {
+  measureCalls++;
+  for (uint8_t i = 0; i < measuredCount_; i++) {
+    if (measured_[i].targetWidth == targetWidth &&
+        measured_[i].targetHeight == targetHeight) {
+      *width  = measured_[i].width;
+      *height = measured_[i].height;
+      return;
+    }
+  }
+  sizeCalls++;
+  size(display, targetWidth, targetHeight, width, height);
+  Measurement *m = &measured_[measuredNext_];
+  measuredNext_  = (measuredNext_ + 1) % MEASURE_CACHE_SIZE;
+  if (measuredCount_ < MEASURE_CACHE_SIZE) {
+    measuredCount_++;
+  }
+  m->targetWidth  = targetWidth;
+  m->targetHeight = targetHeight;
+  m->width        = *width;
+  m->height       = *height;
+}
+
+void LayoutElement::drawClipped(Display *display, int16_t x0, int16_t y0,
+                                uint16_t targetWidth, uint16_t targetHeight,
+                                uint16_t *width, uint16_t *height) {
+  if (display->clipped()) {
+    measure(display, targetWidth, targetHeight, width, height);
+    if (!display->visible(x0, y0, *width, *height)) {
+      return;
+    }
+  }
+  draw(display, x0, y0, targetWidth, targetHeight, width, height);
+}
+
+LayoutText::LayoutText(const String &text, const GFXfont *font, uint16_t color)
+    : font_(font), color_(color) {
+  char *copy = static_cast<char *>(globalArena.allocate(text.length() + 1, 1));
+  memcpy(copy, text.c_str(), text.length() + 1);
+  text_ = copy;
+}
+
 void LayoutText::size(Display *display, uint16_t targetWidth,
                       uint16_t targetHeight, uint16_t *width,
                       uint16_t *height) {
-  if (text_.length() <= 0) {
+  if (text_[0] == '\0') {
     *width  = 0;
     *height = 0;
     return;
   }
   int16_t x1, y1;
-  display->setFont(font_);
-  display->getTextBounds(text_, 0, 0, &x1, &y1, width, height);
+  FontMetrics(font_).bounds(text_, &x1, &y1, width, height);
 }
 
 void LayoutText::draw(Display *display, int16_t x0, int16_t y0,
                       uint16_t targetWidth, uint16_t targetHeight,
                       uint16_t *width, uint16_t *height) {
-  if (text_.length() <= 0) {
+  if (text_[0] == '\0') {
     *width  = 0;
     *height = 0;
     return;
   }
   int16_t x1, y1;
+  FontMetrics(font_).bounds(text_, &x1, &y1, width, height);
   display->setFont(font_);
-  display->getTextBounds(text_, 0, 0, &x1, &y1, width, height);
   display->setTextColor(color_);
   display->setCursor(x0 - x1, y0 - y1);
   display->print(text_);
@@ -57,7 +104,7 @@ void LayoutRotate::size(Display *display, uint16_t targetWidth,
     targetWidth  = targetHeight;
     targetHeight = swap;
   }
-  child_->size(display, targetWidth, targetHeight, width, height);
+  child_->measure(display, targetWidth, targetHeight, width, height);
   if (rotate_ == 1 || rotate_ == 3) {
     swap    = *width;
     *width  = *height;
@@ -74,7 +121,7 @@ void LayoutRotate::draw(Display *display, int16_t x0, int16_t y0,
     targetWidth  = targetHeight;
     targetHeight = swap;
   }
-  child_->size(display, targetWidth, targetHeight, width, height);
+  child_->measure(display, targetWidth, targetHeight, width, height);
 
   switch (rotate_) {
   default:
@@ -103,7 +150,8 @@ void LayoutRotate::draw(Display *display, int16_t x0, int16_t y0,
 
   uint8_t currentRotation = display->getRotation();
   display->setRotation((currentRotation + rotate_) % 4);
-  child_->draw(display, x0, y0, targetWidth, targetHeight, width, height);
+  child_->drawClipped(display, x0, y0, targetWidth, targetHeight, width,
+                      height);
   display->setRotation(currentRotation);
   if (rotate_ == 1 || rotate_ == 3) {
     swap    = *width;
@@ -114,14 +162,20 @@ void LayoutRotate::draw(Display *display, int16_t x0, int16_t y0,
 
 MemArenaAllocator<LayoutEntry> allocatorLayoutEntry(globalArena);
 
-LayoutColumns::LayoutColumns(std::initializer_list<LayoutEntry> elems)
-    : elems_(allocatorLayoutEntry) {
-  elems_.reserve(elems.size());
-  for (const LayoutEntry &info : elems) {
-    elems_.push_back(info);
-  }
+static LayoutEntry *copyEntries(const LayoutEntry *elems, size_t count) {
+  LayoutEntry *copy = static_cast<LayoutEntry *>(
+      globalArena.allocate(count * sizeof(LayoutEntry), alignof(LayoutEntry)));
+  std::uninitialized_copy(elems, elems + count, copy);
+  return copy;
 }
 
+LayoutColumns::LayoutColumns(std::initializer_list<LayoutEntry> elems)
+    : elems_(copyEntries(elems.begin(), elems.size())), count_(elems.size()) {}
+
+LayoutColumns::LayoutColumns(
+    std::vector<LayoutEntry, MemArenaAllocator<LayoutEntry>> elems)
+    : elems_(copyEntries(elems.data(), elems.size())), count_(elems.size()) {}
+
 void LayoutColumns::size(Display *display, uint16_t targetWidth,
                          uint16_t targetHeight, uint16_t *width,
                          uint16_t *height) {
@@ -129,13 +183,13 @@ void LayoutColumns::size(Display *display, uint16_t targetWidth,
   *width          = 0;
   bool canStretch = false;
 
-  for (uint16_t i = 0; i < elems_.size(); i++) {
+  for (uint16_t i = 0; i < count_; i++) {
     if (elems_[i].stretch_) {
       canStretch = true;
     }
     uint16_t columnWidth, columnHeight;
-    elems_[i].elem_->size(display, 0, targetHeight, &columnWidth,
-                          &columnHeight);
+    elems_[i].elem_->measure(display, 0, targetHeight, &columnWidth,
+                             &columnHeight);
     if (columnHeight > *height) {
       *height = columnHeight;
     }
@@ -153,9 +207,10 @@ void LayoutColumns::draw(Display *display, int16_t x0, int16_t y0,
   uint16_t fixedWidth = 0;
   uint16_t splits     = 0;
 
-  for (uint16_t i = 0; i < elems_.size(); i++) {
+  for (uint16_t i = 0; i < count_; i++) {
     uint16_t subwidth, subheight;
-    elems_[i].elem_->size(display, 0, targetHeight, &subwidth, &subheight);
+    elems_[i].elem_->measure(display, 0, targetHeight, &subwidth,
+                             &subheight);
     if (subheight > targetHeight) {
       targetHeight = subheight;
     }
@@ -173,7 +228,7 @@ void LayoutColumns::draw(Display *display, int16_t x0, int16_t y0,
 
   *width  = 0;
   *height = 0;
-  for (uint16_t i = 0; i < elems_.size(); i++) {
+  for (uint16_t i = 0; i < count_; i++) {
     uint16_t subTargetWidth = 0;
     if (elems_[i].stretch_) {
       subTargetWidth = remainingWidth / splits;
@@ -181,8 +236,8 @@ void LayoutColumns::draw(Display *display, int16_t x0, int16_t y0,
       splits--;
     }
     uint16_t subwidth, subheight;
-    elems_[i].elem_->draw(display, x0 + *width, y0, subTargetWidth,
-                          targetHeight, &subwidth, &subheight);
+    elems_[i].elem_->drawClipped(display, x0 + *width, y0, subTargetWidth,
+                                 targetHeight, &subwidth, &subheight);
     *width += subwidth;
     if (subheight > *height) {
       *height = subheight;
@@ -191,12 +246,11 @@ void LayoutColumns::draw(Display *display, int16_t x0, int16_t y0,
 }
 
 LayoutRows::LayoutRows(std::initializer_list<LayoutEntry> elems)
-    : elems_(allocatorLayoutEntry) {
-  elems_.reserve(elems.size());
-  for (const LayoutEntry &info : elems) {
-    elems_.push_back(info);
-  }
-}
+    : elems_(copyEntries(elems.begin(), elems.size())), count_(elems.size()) {}
+
+LayoutRows::LayoutRows(
+    std::vector<LayoutEntry, MemArenaAllocator<LayoutEntry>> elems)
+    : elems_(copyEntries(elems.data(), elems.size())), count_(elems.size()) {}
 
 void LayoutRows::size(Display *display, uint16_t targetWidth,
                       uint16_t targetHeight, uint16_t *width,
@@ -205,12 +259,12 @@ void LayoutRows::size(Display *display, uint16_t targetWidth,
   *height         = 0;
   bool canStretch = false;
 
-  for (uint16_t i = 0; i < elems_.size(); i++) {
+  for (uint16_t i = 0; i < count_; i++) {
     if (elems_[i].stretch_) {
       canStretch = true;
     }
     uint16_t rowWidth, rowHeight;
-    elems_[i].elem_->size(display, targetWidth, 0, &rowWidth, &rowHeight);
+    elems_[i].elem_->measure(display, targetWidth, 0, &rowWidth, &rowHeight);
     if (rowWidth > *width) {
       *width = rowWidth;
     }
@@ -228,9 +282,10 @@ void LayoutRows::draw(Display *display, int16_t x0, int16_t y0,
   uint16_t fixedHeight = 0;
   uint16_t splits      = 0;
 
-  for (uint16_t i = 0; i < elems_.size(); i++) {
+  for (uint16_t i = 0; i < count_; i++) {
     uint16_t subwidth, subheight;
-    elems_[i].elem_->size(display, targetWidth, 0, &subwidth, &subheight);
+    elems_[i].elem_->measure(display, targetWidth, 0, &subwidth,
+                             &subheight);
     if (subwidth > targetWidth) {
       targetWidth = subwidth;
     }
@@ -248,7 +303,7 @@ void LayoutRows::draw(Display *display, int16_t x0, int16_t y0,
 
   *width  = 0;
   *height = 0;
-  for (uint16_t i = 0; i < elems_.size(); i++) {
+  for (uint16_t i = 0; i < count_; i++) {
     uint16_t subTargetHeight = 0;
     if (elems_[i].stretch_) {
       subTargetHeight = remainingHeight / splits;
@@ -256,8 +311,8 @@ void LayoutRows::draw(Display *display, int16_t x0, int16_t y0,
       splits--;
     }
     uint16_t subwidth, subheight;
-    elems_[i].elem_->draw(display, x0, y0 + *height, targetWidth,
-                          subTargetHeight, &subwidth, &subheight);
+    elems_[i].elem_->drawClipped(display, x0, y0 + *height, targetWidth,
+                                 subTargetHeight, &subwidth, &subheight);
     *height += subheight;
     if (subwidth > *width) {
       *width = subwidth;
@@ -268,7 +323,7 @@ void LayoutRows::draw(Display *display, int16_t x0, int16_t y0,
 void LayoutCenter::size(Display *display, uint16_t targetWidth,
                         uint16_t targetHeight, uint16_t *width,
                         uint16_t *height) {
-  child_->size(display, targetWidth, targetHeight, width, height);
+  child_->measure(display, targetWidth, targetHeight, width, height);
   if (*width < targetWidth) {
     *width = targetWidth;
   }
@@ -282,7 +337,7 @@ void LayoutCenter::draw(Display *display, int16_t x0, int16_t y0,
                         uint16_t *width, uint16_t *height) {
   int16_t x0_offset = 0, y0_offset = 0;
 
-  child_->size(display, targetWidth, targetHeight, width, height);
+  child_->measure(display, targetWidth, targetHeight, width, height);
   if (*width < targetWidth) {
     x0_offset = (targetWidth - *width) / 2;
   }
@@ -290,8 +345,8 @@ void LayoutCenter::draw(Display *display, int16_t x0, int16_t y0,
     y0_offset = (targetHeight - *height) / 2;
   }
 
-  child_->draw(display, x0 + x0_offset, y0 + y0_offset, *width, *height, width,
-               height);
+  child_->drawClipped(display, x0 + x0_offset, y0 + y0_offset, *width, *height,
+                      width, height);
 
   *width += x0_offset;
   *height += y0_offset;
@@ -306,7 +361,7 @@ void LayoutCenter::draw(Display *display, int16_t x0, int16_t y0,
 void LayoutHCenter::size(Display *display, uint16_t targetWidth,
                          uint16_t targetHeight, uint16_t *width,
                          uint16_t *height) {
-  child_->size(display, targetWidth, targetHeight, width, height);
+  child_->measure(display, targetWidth, targetHeight, width, height);
   if (*width < targetWidth) {
     *width = targetWidth;
   }
@@ -317,12 +372,13 @@ void LayoutHCenter::draw(Display *display, int16_t x0, int16_t y0,
                          uint16_t *width, uint16_t *height) {
   int16_t x0_offset = 0;
 
-  child_->size(display, targetWidth, targetHeight, width, height);
+  child_->measure(display, targetWidth, targetHeight, width, height);
   if (*width < targetWidth) {
     x0_offset = (targetWidth - *width) / 2;
   }
 
-  child_->draw(display, x0 + x0_offset, y0, *width, *height, width, height);
+  child_->drawClipped(display, x0 + x0_offset, y0, *width, *height, width,
+                      height);
 
   *width += x0_offset;
   if (*width < targetWidth) {
@@ -333,7 +389,7 @@ void LayoutHCenter::draw(Display *display, int16_t x0, int16_t y0,
 void LayoutVCenter::size(Display *display, uint16_t targetWidth,
                          uint16_t targetHeight, uint16_t *width,
                          uint16_t *height) {
-  child_->size(display, targetWidth, targetHeight, width, height);
+  child_->measure(display, targetWidth, targetHeight, width, height);
   if (*height < targetHeight) {
     *height = targetHeight;
   }
@@ -344,12 +400,13 @@ void LayoutVCenter::draw(Display *display, int16_t x0, int16_t y0,
                          uint16_t *width, uint16_t *height) {
   int16_t y0_offset = 0;
 
-  child_->size(display, targetWidth, targetHeight, width, height);
+  child_->measure(display, targetWidth, targetHeight, width, height);
   if (*height < targetHeight) {
     y0_offset = (targetHeight - *height) / 2;
   }
 
-  child_->draw(display, x0, y0 + y0_offset, *width, *height, width, height);
+  child_->drawClipped(display, x0, y0 + y0_offset, *width, *height, width,
+                      height);
 
   *height += y0_offset;
   if (*height < targetHeight) {
@@ -370,7 +427,7 @@ void LayoutPad::size(Display *display, uint16_t targetWidth,
   signedTargetHeight -= (padTop_ + padBottom_);
   targetWidth  = (signedTargetWidth < 0) ? 0 : (uint16_t)signedTargetWidth;
   targetHeight = (signedTargetHeight < 0) ? 0 : (uint16_t)signedTargetHeight;
-  child_->size(display, targetWidth, targetHeight, width, height);
+  child_->measure(display, targetWidth, targetHeight, width, height);
   *width += padLeft_ + padRight_;
   *height += padTop_ + padBottom_;
 }
@@ -384,8 +441,8 @@ void LayoutPad::draw(Display *display, int16_t x0, int16_t y0,
   signedTargetHeight -= (padTop_ + padBottom_);
   targetWidth  = (signedTargetWidth < 0) ? 0 : (uint16_t)signedTargetWidth;
   targetHeight = (signedTargetHeight < 0) ? 0 : (uint16_t)signedTargetHeight;
-  child_->draw(display, x0 + padLeft_, y0 + padTop_, targetWidth, targetHeight,
-               width, height);
+  child_->drawClipped(display, x0 + padLeft_, y0 + padTop_, targetWidth,
+                      targetHeight, width, height);
   *width += padLeft_ + padRight_;
   *height += padTop_ + padBottom_;
 }
@@ -398,7 +455,7 @@ LayoutBorder::LayoutBorder(const LayoutElement &child, bool top, bool right,
 void LayoutBorder::size(Display *display, uint16_t targetWidth,
                         uint16_t targetHeight, uint16_t *width,
                         uint16_t *height) {
-  pad_.size(display, targetWidth, targetHeight, width, height);
+  pad_.measure(display, targetWidth, targetHeight, width, height);
 }
 
 void LayoutBorder::draw(Display *display, int16_t x0, int16_t y0,
@@ -422,29 +479,30 @@ void LayoutBorder::draw(Display *display, int16_t x0, int16_t y0,
 void LayoutBackground::size(Display *display, uint16_t targetWidth,
                             uint16_t targetHeight, uint16_t *width,
                             uint16_t *height) {
-  child_->size(display, targetWidth, targetHeight, width, height);
+  child_->measure(display, targetWidth, targetHeight, width, height);
 }
 
 void LayoutBackground::draw(Display *display, int16_t x0, int16_t y0,
                             uint16_t targetWidth, uint16_t targetHeight,
                             uint16_t *width, uint16_t *height) {
-  child_->size(display, targetWidth, targetHeight, width, height);
+  child_->measure(display, targetWidth, targetHeight, width, height);
   display->fillRect(x0, y0, *width, *height, color_);
-  child_->draw(display, x0, y0, targetWidth, targetHeight, width, height);
+  child_->drawClipped(display, x0, y0, targetWidth, targetHeight, width,
+                      height);
 }
 
 void LayoutOverlay::size(Display *display, uint16_t targetWidth,
                          uint16_t targetHeight, uint16_t *width,
                          uint16_t *height) {
   uint16_t w, h;
-  background_->size(display, targetWidth, targetHeight, &w, &h);
+  background_->measure(display, targetWidth, targetHeight, &w, &h);
   if (targetWidth < w) {
     targetWidth = w;
   }
   if (targetHeight < h) {
     targetHeight = h;
   }
-  foreground_->size(display, targetWidth, targetHeight, width, height);
+  foreground_->measure(display, targetWidth, targetHeight, width, height);
   if (w > *width) {
     *width = w;
   }
@@ -456,12 +514,14 @@ void LayoutOverlay::size(Display *display, uint16_t targetWidth,
 void LayoutOverlay::draw(Display *display, int16_t x0, int16_t y0,
                          uint16_t targetWidth, uint16_t targetHeight,
                          uint16_t *width, uint16_t *height) {
-  background_->draw(display, x0, y0, targetWidth, targetHeight, width, height);
+  background_->drawClipped(display, x0, y0, targetWidth, targetHeight, width,
+                           height);
   if (targetWidth < *width) {
     targetWidth = *width;
   }
   if (targetHeight < *height) {
     targetHeight = *height;
   }
-  foreground_->draw(display, x0, y0, targetWidth, targetHeight, width, height);
+  foreground_->drawClipped(display, x0, y0, targetWidth, targetHeight, width,
+                           height);
 }
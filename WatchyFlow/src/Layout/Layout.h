@@ -2,13 +2,15 @@
 
 #include "../Watchy/Watchy.h"
 #include "Arena.h"
-#include <memory>
 #include <vector>
 #include <initializer_list>
 
+// elements are allocated in globalArena and live until the arena is reset, so
+// they are linked with plain pointers. clone() makes a shallow copy, children
+// are shared with the original rather than copied.
 class LayoutElement {
 public:
-  typedef std::shared_ptr<LayoutElement> ptr;
+  typedef LayoutElement *ptr;
 
 public:
   virtual void size(Display *display, uint16_t targetWidth,
@@ -20,6 +22,23 @@ public:
   virtual LayoutElement::ptr clone() const             = 0;
   virtual ~LayoutElement()                             = default;
 
+  // size(), remembered per constraint. parents measure their children through
+  // this, since draw() usually measures the same child again. trees are built
+  // for a single frame, so nothing is remembered across frames.
+  void measure(Display *display, uint16_t targetWidth, uint16_t targetHeight,
+               uint16_t *width, uint16_t *height);
+
+  // draw(), unless the display is clipped and the element would land
+  // entirely outside the clip rectangle. then only its size is worked out.
+  // parents draw their children through this, so a clipped frame only
+  // rasterizes the elements that reach the rectangle.
+  void drawClipped(Display *display, int16_t x0, int16_t y0,
+                   uint16_t targetWidth, uint16_t targetHeight, uint16_t *width,
+                   uint16_t *height);
+
+  static uint32_t measureCalls; // measure() calls
+  static uint32_t sizeCalls;    // measure() calls that had to run size()
+
   static void *operator new(size_t size);
   static void *operator new[](size_t size);
   static void operator delete(void *ptr, size_t size) noexcept;
@@ -33,6 +52,21 @@ protected:
   LayoutElement &operator=(const LayoutElement &) = delete;
   LayoutElement(LayoutElement &&)                 = delete;
   LayoutElement &operator=(LayoutElement &&)      = delete;
+
+  // for elements whose size changes after they were measured.
+  void forgetMeasurements() { measuredCount_ = 0; }
+
+private:
+  static const uint8_t MEASURE_CACHE_SIZE = 2;
+
+  typedef struct Measurement {
+    uint16_t targetWidth, targetHeight;
+    uint16_t width, height;
+  } Measurement;
+
+  Measurement measured_[MEASURE_CACHE_SIZE];
+  uint8_t measuredCount_ = 0;
+  uint8_t measuredNext_  = 0;
 };
 
 class LayoutBitmap : public LayoutElement {
@@ -55,9 +89,7 @@ public:
     *height = h_;
   }
 
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutBitmap>(*this);
-  }
+  LayoutElement::ptr clone() const override { return new LayoutBitmap(*this); }
 
 private:
   const uint8_t *bitmap_;
@@ -67,8 +99,8 @@ private:
 
 class LayoutText : public LayoutElement {
 public:
-  LayoutText(String text, const GFXfont *font, uint16_t color)
-      : text_(text), font_(font), color_(color) {}
+  // the text is copied into globalArena.
+  LayoutText(const String &text, const GFXfont *font, uint16_t color);
   LayoutText(const LayoutText &copy)
       : text_(copy.text_), font_(copy.font_), color_(copy.color_) {}
 
@@ -77,12 +109,10 @@ public:
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override;
 
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutText>(*this);
-  }
+  LayoutElement::ptr clone() const override { return new LayoutText(*this); }
 
 private:
-  String text_;
+  const char *text_;
   const GFXfont *font_;
   uint16_t color_;
 };
@@ -105,41 +135,39 @@ extern MemArenaAllocator<LayoutEntry> allocatorLayoutEntry;
 class LayoutColumns : public LayoutElement {
 public:
   LayoutColumns(std::initializer_list<LayoutEntry> elems);
-  LayoutColumns(std::vector<LayoutEntry, MemArenaAllocator<LayoutEntry>> elems)
-      : elems_(std::move(elems)) {}
-  LayoutColumns(const LayoutColumns &copy) : elems_(copy.elems_) {}
+  LayoutColumns(std::vector<LayoutEntry, MemArenaAllocator<LayoutEntry>> elems);
+  LayoutColumns(const LayoutColumns &copy)
+      : elems_(copy.elems_), count_(copy.count_) {}
 
   void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
             uint16_t *width, uint16_t *height) override;
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override;
 
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutColumns>(*this);
-  }
+  LayoutElement::ptr clone() const override { return new LayoutColumns(*this); }
 
 private:
-  std::vector<LayoutEntry, MemArenaAllocator<LayoutEntry>> elems_;
+  LayoutEntry *elems_;
+  uint16_t count_;
 };
 
 class LayoutRows : public LayoutElement {
 public:
   LayoutRows(std::initializer_list<LayoutEntry> elems);
-  LayoutRows(std::vector<LayoutEntry, MemArenaAllocator<LayoutEntry>> elems)
-      : elems_(std::move(elems)) {}
-  LayoutRows(const LayoutRows &copy) : elems_(copy.elems_) {}
+  LayoutRows(std::vector<LayoutEntry, MemArenaAllocator<LayoutEntry>> elems);
+  LayoutRows(const LayoutRows &copy)
+      : elems_(copy.elems_), count_(copy.count_) {}
 
   void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
             uint16_t *width, uint16_t *height) override;
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override;
 
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutRows>(*this);
-  }
+  LayoutElement::ptr clone() const override { return new LayoutRows(*this); }
 
 private:
-  std::vector<LayoutEntry, MemArenaAllocator<LayoutEntry>> elems_;
+  LayoutEntry *elems_;
+  uint16_t count_;
 };
 
 class LayoutFill : public LayoutElement {
@@ -156,9 +184,7 @@ public:
     *height = targetHeight;
   }
 
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutFill>();
-  }
+  LayoutElement::ptr clone() const override { return new LayoutFill(); }
 };
 
 class LayoutCenter : public LayoutElement {
@@ -171,9 +197,7 @@ public:
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override;
 
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutCenter>(*this);
-  }
+  LayoutElement::ptr clone() const override { return new LayoutCenter(*this); }
 
 private:
   LayoutElement::ptr child_;
@@ -189,9 +213,7 @@ public:
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override;
 
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutHCenter>(*this);
-  }
+  LayoutElement::ptr clone() const override { return new LayoutHCenter(*this); }
 
 private:
   LayoutElement::ptr child_;
@@ -207,9 +229,7 @@ public:
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override;
 
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutVCenter>(*this);
-  }
+  LayoutElement::ptr clone() const override { return new LayoutVCenter(*this); }
 
 private:
   LayoutElement::ptr child_;
@@ -234,9 +254,7 @@ public:
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override;
 
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutPad>(*this);
-  }
+  LayoutElement::ptr clone() const override { return new LayoutPad(*this); }
 
 private:
   LayoutElement::ptr child_;
@@ -263,9 +281,7 @@ public:
     *height = size_;
   }
 
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutSpacer>(*this);
-  }
+  LayoutElement::ptr clone() const override { return new LayoutSpacer(*this); }
 
 private:
   uint16_t size_;
@@ -284,9 +300,7 @@ public:
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override;
 
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutRotate>(*this);
-  }
+  LayoutElement::ptr clone() const override { return new LayoutRotate(*this); }
 
 private:
   LayoutElement::ptr child_;
@@ -306,9 +320,7 @@ public:
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override;
 
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutBorder>(*this);
-  }
+  LayoutElement::ptr clone() const override { return new LayoutBorder(*this); }
 
 private:
   LayoutPad pad_;
@@ -329,7 +341,7 @@ public:
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override;
 
   LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutBackground>(*this);
+    return new LayoutBackground(*this);
   }
 
 private:
@@ -351,9 +363,7 @@ public:
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override;
 
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutOverlay>(*this);
-  }
+  LayoutElement::ptr clone() const override { return new LayoutOverlay(*this); }
 
 private:
   LayoutElement::ptr background_;
@@ -368,7 +378,7 @@ public:
 
   void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
             uint16_t *width, uint16_t *height) override {
-    child_->size(display, targetWidth, targetHeight, width, height);
+    child_->measure(display, targetWidth, targetHeight, width, height);
     if (*width < targetWidth) {
       *width = targetWidth;
     }
@@ -376,18 +386,18 @@ public:
 
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override {
-    child_->size(display, targetWidth, targetHeight, width, height);
+    child_->measure(display, targetWidth, targetHeight, width, height);
     int16_t adjustment = 0;
     if (*width < targetWidth) {
       adjustment = targetWidth - *width;
     }
-    child_->draw(display, x0 + adjustment, y0, targetWidth - adjustment,
-                 targetHeight, width, height);
+    child_->drawClipped(display, x0 + adjustment, y0, targetWidth - adjustment,
+                        targetHeight, width, height);
     *width += adjustment;
   }
 
   LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutRightAlign>(*this);
+    return new LayoutRightAlign(*this);
   }
 
 private:
@@ -402,7 +412,7 @@ public:
 
   void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
             uint16_t *width, uint16_t *height) override {
-    child_->size(display, targetWidth, targetHeight, width, height);
+    child_->measure(display, targetWidth, targetHeight, width, height);
     if (*height < targetHeight) {
       *height = targetHeight;
     }
@@ -410,18 +420,18 @@ public:
 
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
             uint16_t targetHeight, uint16_t *width, uint16_t *height) override {
-    child_->size(display, targetWidth, targetHeight, width, height);
+    child_->measure(display, targetWidth, targetHeight, width, height);
     int16_t adjustment = 0;
     if (*height < targetHeight) {
       adjustment = targetHeight - *height;
     }
-    child_->draw(display, x0, y0 + adjustment, targetWidth,
-                 targetHeight - adjustment, width, height);
+    child_->drawClipped(display, x0, y0 + adjustment, targetWidth,
+                        targetHeight - adjustment, width, height);
     *height += adjustment;
   }
 
   LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutBottomAlign>(*this);
+    return new LayoutBottomAlign(*this);
   }
 
 private:
@@ -441,7 +451,7 @@ public:
       *height = 0;
       return;
     }
-    child_->size(display, targetWidth, targetHeight, width, height);
+    child_->measure(display, targetWidth, targetHeight, width, height);
   }
 
   void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
@@ -451,15 +461,17 @@ public:
       *height = 0;
       return;
     }
-    child_->draw(display, x0, y0, targetWidth, targetHeight, width, height);
+    child_->drawClipped(display, x0, y0, targetWidth, targetHeight, width,
+                        height);
   }
 
-  void set(const LayoutElement &child) { child_ = child.clone(); }
-
-  LayoutElement::ptr clone() const override {
-    return std::make_shared<LayoutCell>(*this);
+  void set(const LayoutElement &child) {
+    child_ = child.clone();
+    forgetMeasurements();
   }
 
+  LayoutElement::ptr clone() const override { return new LayoutCell(*this); }
+
 private:
   LayoutElement::ptr child_;
 };
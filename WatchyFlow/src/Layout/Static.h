@@ -0,0 +1,548 @@
+#pragma once
+
+#include "Layout.h"
+#include "FontMetrics.h"
+
+// a layout whose structure is fixed at compile time. elements are plain
+// values nested inside their parents, so a whole screen is a single object on
+// the stack: nothing is allocated, every call is resolved statically, and the
+// sizes of spacers are folded into their parents as constants. the sizing
+// rules are the same as the matching Layout* elements.
+//
+//   auto layout = Static::vcenter(Static::rows(
+//       Static::hcenter(Static::text(label, &FreeSans9pt7b, GxEPD_BLACK)),
+//       Static::spacer<5>(), Static::element(dynamicChild)));
+//   layout.draw(display, 0, 0, display->width(), display->height(), &w, &h);
+//
+// Static::element() puts a LayoutElement inside a static layout, and
+// layoutStatic() turns a static layout into a LayoutElement.
+namespace Static {
+
+constexpr uint16_t maxOf(uint16_t a, uint16_t b) { return a > b ? a : b; }
+
+// defaults for every element. fixed elements have the same size whatever
+// they are offered, so parents add fixedWidth/fixedHeight without asking.
+struct Node {
+  static constexpr bool fixed           = false;
+  static constexpr bool stretch         = false;
+  static constexpr uint16_t fixedWidth  = 0;
+  static constexpr uint16_t fixedHeight = 0;
+};
+
+template <uint16_t N> struct Spacer : Node {
+  static constexpr bool fixed           = true;
+  static constexpr uint16_t fixedWidth  = N;
+  static constexpr uint16_t fixedHeight = N;
+
+  void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
+            uint16_t *width, uint16_t *height) {
+    *width  = N;
+    *height = N;
+  }
+
+  void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
+            uint16_t targetHeight, uint16_t *width, uint16_t *height) {
+    *width  = N;
+    *height = N;
+  }
+};
+
+struct Fill : Node {
+  void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
+            uint16_t *width, uint16_t *height) {
+    *width  = targetWidth;
+    *height = targetHeight;
+  }
+
+  void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
+            uint16_t targetHeight, uint16_t *width, uint16_t *height) {
+    *width  = targetWidth;
+    *height = targetHeight;
+  }
+};
+
+// the text is not copied and has to outlive the layout. its bounds are
+// measured once and kept, since they don't depend on the space offered.
+class Text : public Node {
+public:
+  Text(const char *text, const GFXfont *font, uint16_t color)
+      : text_(text), font_(font), color_(color) {}
+
+  void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
+            uint16_t *width, uint16_t *height) {
+    bounds(display);
+    *width  = w_;
+    *height = h_;
+  }
+
+  void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
+            uint16_t targetHeight, uint16_t *width, uint16_t *height) {
+    bounds(display);
+    *width  = w_;
+    *height = h_;
+    if (text_[0] == '\0' || !display->visible(x0, y0, w_, h_)) {
+      return;
+    }
+    display->setFont(font_);
+    display->setTextColor(color_);
+    display->setCursor(x0 - x1_, y0 - y1_);
+    display->print(text_);
+  }
+
+private:
+  void bounds(Display *display) {
+    if (measured_) {
+      return;
+    }
+    measured_ = true;
+    if (text_[0] == '\0') {
+      return;
+    }
+    FontMetrics(font_).bounds(text_, &x1_, &y1_, &w_, &h_);
+  }
+
+  const char *text_;
+  const GFXfont *font_;
+  uint16_t color_;
+  bool measured_ = false;
+  int16_t x1_ = 0, y1_ = 0;
+  uint16_t w_ = 0, h_ = 0;
+};
+
+// a dynamic element as a leaf. the element is referenced, not copied.
+class Element : public Node {
+public:
+  explicit Element(LayoutElement &elem) : elem_(&elem) {}
+
+  void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
+            uint16_t *width, uint16_t *height) {
+    elem_->measure(display, targetWidth, targetHeight, width, height);
+  }
+
+  void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
+            uint16_t targetHeight, uint16_t *width, uint16_t *height) {
+    elem_->drawClipped(display, x0, y0, targetWidth, targetHeight, width,
+                       height);
+  }
+
+private:
+  LayoutElement *elem_;
+};
+
+template <typename C> class HCenter : public Node {
+public:
+  explicit HCenter(const C &child) : child_(child) {}
+
+  void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
+            uint16_t *width, uint16_t *height) {
+    child_.size(display, targetWidth, targetHeight, width, height);
+    if (*width < targetWidth) {
+      *width = targetWidth;
+    }
+  }
+
+  void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
+            uint16_t targetHeight, uint16_t *width, uint16_t *height) {
+    int16_t x0_offset = 0;
+
+    child_.size(display, targetWidth, targetHeight, width, height);
+    if (*width < targetWidth) {
+      x0_offset = (targetWidth - *width) / 2;
+    }
+
+    child_.draw(display, x0 + x0_offset, y0, *width, *height, width, height);
+
+    *width += x0_offset;
+    if (*width < targetWidth) {
+      *width = targetWidth;
+    }
+  }
+
+private:
+  C child_;
+};
+
+template <typename C> class VCenter : public Node {
+public:
+  explicit VCenter(const C &child) : child_(child) {}
+
+  void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
+            uint16_t *width, uint16_t *height) {
+    child_.size(display, targetWidth, targetHeight, width, height);
+    if (*height < targetHeight) {
+      *height = targetHeight;
+    }
+  }
+
+  void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
+            uint16_t targetHeight, uint16_t *width, uint16_t *height) {
+    int16_t y0_offset = 0;
+
+    child_.size(display, targetWidth, targetHeight, width, height);
+    if (*height < targetHeight) {
+      y0_offset = (targetHeight - *height) / 2;
+    }
+
+    child_.draw(display, x0, y0 + y0_offset, *width, *height, width, height);
+
+    *height += y0_offset;
+    if (*height < targetHeight) {
+      *height = targetHeight;
+    }
+  }
+
+private:
+  C child_;
+};
+
+template <typename C> class Center : public Node {
+public:
+  explicit Center(const C &child) : child_(child) {}
+
+  void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
+            uint16_t *width, uint16_t *height) {
+    child_.size(display, targetWidth, targetHeight, width, height);
+    if (*width < targetWidth) {
+      *width = targetWidth;
+    }
+    if (*height < targetHeight) {
+      *height = targetHeight;
+    }
+  }
+
+  void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
+            uint16_t targetHeight, uint16_t *width, uint16_t *height) {
+    int16_t x0_offset = 0, y0_offset = 0;
+
+    child_.size(display, targetWidth, targetHeight, width, height);
+    if (*width < targetWidth) {
+      x0_offset = (targetWidth - *width) / 2;
+    }
+    if (*height < targetHeight) {
+      y0_offset = (targetHeight - *height) / 2;
+    }
+
+    child_.draw(display, x0 + x0_offset, y0 + y0_offset, *width, *height,
+                width, height);
+
+    *width += x0_offset;
+    *height += y0_offset;
+    if (*width < targetWidth) {
+      *width = targetWidth;
+    }
+    if (*height < targetHeight) {
+      *height = targetHeight;
+    }
+  }
+
+private:
+  C child_;
+};
+
+template <int16_t Top, int16_t Right, int16_t Bottom, int16_t Left,
+          typename C>
+class Pad : public Node {
+public:
+  static constexpr bool fixed           = C::fixed;
+  static constexpr uint16_t fixedWidth  = C::fixedWidth + Left + Right;
+  static constexpr uint16_t fixedHeight = C::fixedHeight + Top + Bottom;
+
+  explicit Pad(const C &child) : child_(child) {}
+
+  void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
+            uint16_t *width, uint16_t *height) {
+    child_.size(display, inner(targetWidth, Left + Right),
+                inner(targetHeight, Top + Bottom), width, height);
+    *width += Left + Right;
+    *height += Top + Bottom;
+  }
+
+  void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
+            uint16_t targetHeight, uint16_t *width, uint16_t *height) {
+    child_.draw(display, x0 + Left, y0 + Top, inner(targetWidth, Left + Right),
+                inner(targetHeight, Top + Bottom), width, height);
+    *width += Left + Right;
+    *height += Top + Bottom;
+  }
+
+private:
+  static uint16_t inner(uint16_t target, int16_t pad) {
+    int16_t signedTarget = (int16_t)target - pad;
+    return (signedTarget < 0) ? 0 : (uint16_t)signedTarget;
+  }
+
+  C child_;
+};
+
+template <bool Top, bool Right, bool Bottom, bool Left, typename C>
+class Border : public Node {
+public:
+  Border(const C &child, uint16_t color) : pad_(child), color_(color) {}
+
+  void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
+            uint16_t *width, uint16_t *height) {
+    pad_.size(display, targetWidth, targetHeight, width, height);
+  }
+
+  void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
+            uint16_t targetHeight, uint16_t *width, uint16_t *height) {
+    pad_.draw(display, x0, y0, targetWidth, targetHeight, width, height);
+    if (Top) {
+      display->drawFastHLine(x0, y0, *width, color_);
+    }
+    if (Bottom) {
+      display->drawFastHLine(x0, y0 + *height - 1, *width, color_);
+    }
+    if (Left) {
+      display->drawFastVLine(x0, y0, *height, color_);
+    }
+    if (Right) {
+      display->drawFastVLine(x0 + *width - 1, y0, *height, color_);
+    }
+  }
+
+private:
+  Pad<Top ? 1 : 0, Right ? 1 : 0, Bottom ? 1 : 0, Left ? 1 : 0, C> pad_;
+  uint16_t color_;
+};
+
+template <typename C> class Background : public Node {
+public:
+  Background(const C &child, uint16_t color) : child_(child), color_(color) {}
+
+  void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
+            uint16_t *width, uint16_t *height) {
+    child_.size(display, targetWidth, targetHeight, width, height);
+  }
+
+  void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
+            uint16_t targetHeight, uint16_t *width, uint16_t *height) {
+    child_.size(display, targetWidth, targetHeight, width, height);
+    display->fillRect(x0, y0, *width, *height, color_);
+    child_.draw(display, x0, y0, targetWidth, targetHeight, width, height);
+  }
+
+private:
+  C child_;
+  uint16_t color_;
+};
+
+// marks a child of rows() or columns() that takes a share of the leftover
+// space, like LayoutEntry(elem, true).
+template <typename C> class Stretch : public C {
+public:
+  static constexpr bool fixed   = false;
+  static constexpr bool stretch = true;
+
+  explicit Stretch(const C &child) : C(child) {}
+};
+
+// the children of Rows (Vertical) or Columns, one per level of nesting. the
+// main axis is the one the children are stacked along.
+template <bool Vertical, typename... Cs> class Stack;
+
+template <bool Vertical> class Stack<Vertical> {
+public:
+  static constexpr uint16_t constMain  = 0;
+  static constexpr uint16_t constCross = 0;
+  static constexpr uint16_t splits     = 0;
+
+  void measure(Display *display, uint16_t targetCross, uint16_t *cross,
+               uint16_t *main, uint16_t *fixedMain) {}
+  void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetCross,
+            uint16_t *remaining, uint16_t *splitsLeft, uint16_t *cross,
+            uint16_t *main) {}
+};
+
+template <bool Vertical, typename C, typename... Cs>
+class Stack<Vertical, C, Cs...> {
+public:
+  typedef Stack<Vertical, Cs...> Rest;
+
+  // fixed children are never measured, their sizes are summed here.
+  static constexpr uint16_t constMain =
+      (C::fixed ? (Vertical ? C::fixedHeight : C::fixedWidth) : 0) +
+      Rest::constMain;
+  static constexpr uint16_t constCross =
+      maxOf(C::fixed ? (Vertical ? C::fixedWidth : C::fixedHeight) : 0,
+            Rest::constCross);
+  static constexpr uint16_t splits = (C::stretch ? 1 : 0) + Rest::splits;
+
+  Stack(const C &first, const Cs &...rest) : first_(first), rest_(rest...) {}
+
+  // adds the sizes of the children that aren't fixed.
+  void measure(Display *display, uint16_t targetCross, uint16_t *cross,
+               uint16_t *main, uint16_t *fixedMain) {
+    if (!C::fixed) {
+      uint16_t w, h;
+      first_.size(display, Vertical ? targetCross : 0,
+                  Vertical ? 0 : targetCross, &w, &h);
+      uint16_t subCross = Vertical ? w : h;
+      uint16_t subMain  = Vertical ? h : w;
+      if (subCross > *cross) {
+        *cross = subCross;
+      }
+      *main += subMain;
+      if (!C::stretch) {
+        *fixedMain += subMain;
+      }
+    }
+    rest_.measure(display, targetCross, cross, main, fixedMain);
+  }
+
+  void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetCross,
+            uint16_t *remaining, uint16_t *splitsLeft, uint16_t *cross,
+            uint16_t *main) {
+    uint16_t subTargetMain = 0;
+    if (C::stretch) {
+      subTargetMain = *remaining / *splitsLeft;
+      *remaining -= subTargetMain;
+      (*splitsLeft)--;
+    }
+    uint16_t w, h;
+    if (Vertical) {
+      first_.draw(display, x0, y0 + *main, targetCross, subTargetMain, &w, &h);
+    } else {
+      first_.draw(display, x0 + *main, y0, subTargetMain, targetCross, &w, &h);
+    }
+    uint16_t subCross = Vertical ? w : h;
+    *main += Vertical ? h : w;
+    if (subCross > *cross) {
+      *cross = subCross;
+    }
+    rest_.draw(display, x0, y0, targetCross, remaining, splitsLeft, cross,
+               main);
+  }
+
+private:
+  C first_;
+  Rest rest_;
+};
+
+template <bool Vertical, typename... Cs> class Linear : public Node {
+public:
+  explicit Linear(const Cs &...children) : children_(children...) {}
+
+  void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
+            uint16_t *width, uint16_t *height) {
+    uint16_t targetCross = Vertical ? targetWidth : targetHeight;
+    uint16_t targetMain  = Vertical ? targetHeight : targetWidth;
+    uint16_t cross       = maxOf(targetCross, Children::constCross);
+    uint16_t main        = Children::constMain;
+    uint16_t fixedMain   = Children::constMain;
+    children_.measure(display, targetCross, &cross, &main, &fixedMain);
+    if (Children::splits > 0 && main < targetMain) {
+      main = targetMain;
+    }
+    *width  = Vertical ? cross : main;
+    *height = Vertical ? main : cross;
+  }
+
+  void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
+            uint16_t targetHeight, uint16_t *width, uint16_t *height) {
+    uint16_t targetCross = Vertical ? targetWidth : targetHeight;
+    uint16_t targetMain  = Vertical ? targetHeight : targetWidth;
+    uint16_t main        = Children::constMain;
+    uint16_t fixedMain   = Children::constMain;
+    targetCross          = maxOf(targetCross, Children::constCross);
+    children_.measure(display, targetCross, &targetCross, &main, &fixedMain);
+
+    uint16_t remaining = 0;
+    if (targetMain > fixedMain) {
+      remaining = targetMain - fixedMain;
+    }
+    uint16_t splitsLeft = Children::splits;
+
+    uint16_t cross = 0;
+    main           = 0;
+    children_.draw(display, x0, y0, targetCross, &remaining, &splitsLeft,
+                   &cross, &main);
+    *width  = Vertical ? cross : main;
+    *height = Vertical ? main : cross;
+  }
+
+private:
+  typedef Stack<Vertical, Cs...> Children;
+  Children children_;
+};
+
+template <typename... Cs> using Rows    = Linear<true, Cs...>;
+template <typename... Cs> using Columns = Linear<false, Cs...>;
+
+template <uint16_t N> inline Spacer<N> spacer() { return Spacer<N>(); }
+
+inline Fill fill() { return Fill(); }
+
+inline Text text(const char *text, const GFXfont *font, uint16_t color) {
+  return Text(text, font, color);
+}
+
+inline Element element(LayoutElement &elem) { return Element(elem); }
+
+template <typename C> HCenter<C> hcenter(const C &child) {
+  return HCenter<C>(child);
+}
+
+template <typename C> VCenter<C> vcenter(const C &child) {
+  return VCenter<C>(child);
+}
+
+template <typename C> Center<C> center(const C &child) {
+  return Center<C>(child);
+}
+
+template <int16_t Top, int16_t Right, int16_t Bottom, int16_t Left,
+          typename C>
+Pad<Top, Right, Bottom, Left, C> pad(const C &child) {
+  return Pad<Top, Right, Bottom, Left, C>(child);
+}
+
+template <bool Top, bool Right, bool Bottom, bool Left, typename C>
+Border<Top, Right, Bottom, Left, C> border(const C &child, uint16_t color) {
+  return Border<Top, Right, Bottom, Left, C>(child, color);
+}
+
+template <typename C>
+Background<C> background(const C &child, uint16_t color) {
+  return Background<C>(child, color);
+}
+
+template <typename C> Stretch<C> stretch(const C &child) {
+  return Stretch<C>(child);
+}
+
+template <typename... Cs> Rows<Cs...> rows(const Cs &...children) {
+  return Rows<Cs...>(children...);
+}
+
+template <typename... Cs> Columns<Cs...> columns(const Cs &...children) {
+  return Columns<Cs...>(children...);
+}
+
+} // namespace Static
+
+// a static layout as a LayoutElement, so it can be a leaf of a dynamic tree.
+template <typename C> class LayoutStatic : public LayoutElement {
+public:
+  explicit LayoutStatic(const C &layout) : layout_(layout) {}
+  LayoutStatic(const LayoutStatic &copy) : layout_(copy.layout_) {}
+
+  void size(Display *display, uint16_t targetWidth, uint16_t targetHeight,
+            uint16_t *width, uint16_t *height) override {
+    layout_.size(display, targetWidth, targetHeight, width, height);
+  }
+
+  void draw(Display *display, int16_t x0, int16_t y0, uint16_t targetWidth,
+            uint16_t targetHeight, uint16_t *width, uint16_t *height) override {
+    layout_.draw(display, x0, y0, targetWidth, targetHeight, width, height);
+  }
+
+  LayoutElement::ptr clone() const override { return new LayoutStatic(*this); }
+
+private:
+  C layout_;
+};
+
+template <typename C> LayoutStatic<C> layoutStatic(const C &layout) {
+  return LayoutStatic<C>(layout);
+}
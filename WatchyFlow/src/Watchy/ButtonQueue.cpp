@@ -0,0 +1,54 @@
+#include "ButtonQueue.h"
+
+void ButtonQueue::start(uint8_t held, uint32_t millis) {
+  first_ = 0;
+  size_  = 0;
+  held_  = held;
+  for (uint8_t i = 0; i < 4; i++) {
+    changed_[i] = millis;
+  }
+}
+
+void ButtonQueue::sample(uint8_t held, uint32_t millis) {
+  uint8_t changed = held ^ held_;
+  held_           = held;
+  for (uint8_t button = 0; button < 4; button++) {
+    if ((changed & (1 << button)) == 0) {
+      continue;
+    }
+    // contacts bounce when pressed and when let go, so a press only counts
+    // once the button settled after its last change.
+    bool settled     = millis - changed_[button] >= DEBOUNCE_MS;
+    changed_[button] = millis;
+    if (!settled || (held & (1 << button)) == 0) {
+      continue;
+    }
+
+    if (size_ > 0) {
+      Press &last = presses_[(first_ + size_ - 1) % SIZE];
+      if (last.button == button && last.count < 0xFF) {
+        last.count++;
+        continue;
+      }
+    }
+    if (size_ == SIZE) {
+      // dropped, nobody presses this fast on purpose.
+      continue;
+    }
+    Press &press = presses_[(first_ + size_) % SIZE];
+    press.button = button;
+    press.count  = 1;
+    size_++;
+  }
+}
+
+bool ButtonQueue::pop(uint8_t *button, uint8_t *count) {
+  if (size_ == 0) {
+    return false;
+  }
+  *button = presses_[first_].button;
+  *count  = presses_[first_].count;
+  first_  = (first_ + 1) % SIZE;
+  size_--;
+  return true;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <Arduino.h>
+
+// presses of the four buttons, found by sampling which are held. each press
+// counts once, and presses of the same button in a row are merged, so they
+// can all be handled before a single redraw.
+class ButtonQueue {
+public:
+  static const uint8_t SIZE        = 8;
+  static const uint8_t DEBOUNCE_MS = 30;
+
+  // starts over with held buttons already down, so they don't count.
+  void start(uint8_t held, uint32_t millis);
+  // held has bit i set while button i is down.
+  void sample(uint8_t held, uint32_t millis);
+  // the oldest press and how many times in a row it came.
+  bool pop(uint8_t *button, uint8_t *count);
+  bool empty() const { return size_ == 0; }
+
+private:
+  typedef struct Press {
+    uint8_t button;
+    uint8_t count;
+  } Press;
+
+  Press presses_[SIZE];
+  uint8_t first_ = 0;
+  uint8_t size_  = 0;
+  uint8_t held_  = 0;
+  uint32_t changed_[4]; // when each button last went down or up
+};
@@ -19,13 +19,54 @@
 // performance for Watchy Project: Link: https://github.com/sqfmi/Watchy
 
 #include "Display.h"
+#include "rom/crc.h"
+#include "Profiler.h"
 
 RTC_DATA_ATTR bool displayFullInit = true;
+RTC_DATA_ATTR bool tileHashesValid  = false;
+RTC_DATA_ATTR uint32_t tileHashes[WatchyDisplay::TILE_COUNT];
+RTC_DATA_ATTR uint32_t frameCrc;
+// a frame limited to some tiles leaves the crc of what the panel shows unknown
+RTC_DATA_ATTR bool frameCrcValid;
+RTC_DATA_ATTR DisplayStats displayStats;
+
+const DisplayStats &WatchyDisplay::stats() { return displayStats; }
+
+bool WatchyDisplay::frameKnown() { return tileHashesValid && !_initial_write; }
+
+// Waveshare's partial update waveform for this panel (1.54" V2), followed by
+// the EOPT, gate voltage, source voltages and VCOM values it was tuned with.
+static const uint8_t fastLut[159] = {
+    0x0,  0x40, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
+    0x80, 0x80, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
+    0x40, 0x40, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
+    0x0,  0x80, 0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
+    0xF,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x1,  0x1,  0x0,  0x0,  0x0,
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
+    0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,  0x0,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0,  0x0,  0x0,  0x02, 0x17, 0x41,
+    0xB0, 0x32, 0x28,
+};
+
+void (*WatchyDisplay::whileBusy)() = nullptr;
+
+bool WatchyDisplay::sleepWhileBusy = true;
 
 void WatchyDisplay::busyCallback(const void *) {
-  gpio_wakeup_enable((gpio_num_t)DISPLAY_BUSY, GPIO_INTR_LOW_LEVEL);
-  esp_sleep_enable_gpio_wakeup();
-  esp_light_sleep_start();
+  if (sleepWhileBusy) {
+    gpio_wakeup_enable((gpio_num_t)DISPLAY_BUSY, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    esp_light_sleep_start();
+  } else {
+    delay(1);
+  }
+  if (whileBusy != nullptr)
+    whileBusy();
 }
 
 WatchyDisplay::WatchyDisplay()
@@ -38,14 +79,27 @@ WatchyDisplay::WatchyDisplay()
 #endif
   selectSPI(SPI, SPISettings(20000000, MSBFIRST, SPI_MODE0));
   setBusyCallback(busyCallback);
+  // until initWatchy runs, report the state it will set up, so frames can be
+  // compared against the panel without waking the controller.
+  _initial_write   = displayFullInit;
+  _initial_refresh = displayFullInit;
 }
 
 void WatchyDisplay::initWatchy() {
+  ProfileScope phase(PHASE_PANEL);
   // Watchy default initialization
   init(0, displayFullInit, 2, true);
+  _awake = true;
+}
+
+void WatchyDisplay::_ensureAwake() {
+  if (!_awake)
+    initWatchy();
 }
 
 void WatchyDisplay::asyncPowerOn() {
+  _ensureAwake();
+  waitRefresh();
   // This is expensive if unused
   if (!waitingPowerOn && !_hibernating) {
     _InitDisplay();
@@ -54,9 +108,11 @@ void WatchyDisplay::asyncPowerOn() {
 }
 
 void WatchyDisplay::setDarkBorder(bool dark) {
-  if (_hibernating)
-    return;
   darkBorder = dark;
+  // _InitDisplay applies the border once the controller is up.
+  if (!_awake || _hibernating)
+    return;
+  waitRefresh();
   _startTransfer();
   _transferCommand(0x3C); // BorderWavefrom
   _transfer(dark ? 0x02 : 0x05);
@@ -70,6 +126,8 @@ void WatchyDisplay::clearScreen(uint8_t value) {
 }
 
 void WatchyDisplay::writeScreenBuffer(uint8_t value) {
+  _ensureAwake();
+  waitRefresh();
   if (!_using_partial_mode)
     _Init_Part();
   if (_initial_write)
@@ -79,43 +137,228 @@ void WatchyDisplay::writeScreenBuffer(uint8_t value) {
 }
 
 void WatchyDisplay::writeScreenBufferAgain(uint8_t value) {
+  _ensureAwake();
+  waitRefresh();
   if (!_using_partial_mode)
     _Init_Part();
   _writeScreenBuffer(0x24, value); // set current
 }
 
 void WatchyDisplay::_writeScreenBuffer(uint8_t command, uint8_t value) {
+  tileHashesValid = false;
   _startTransfer();
   _transferCommand(command);
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++) {
-    _transfer(value);
-  }
+  SPI.writePattern(&value, 1, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
+  displayStats.bytesSent += uint32_t(WIDTH) * uint32_t(HEIGHT) / 8;
 }
 
 void WatchyDisplay::writeImage(const uint8_t bitmap[], int16_t x, int16_t y,
                                int16_t w, int16_t h, bool invert, bool mirror_y,
                                bool pgm) {
-  _writeImage(0x24, bitmap, x, y, w, h, invert, mirror_y, pgm);
+  waitRefresh();
+  _dirtyPending  = false;
+  uint64_t tiles = _tileLimit;
+  _tileLimit     = ALL_TILES;
+  if (!_isFullFrame(x, y, w, h, invert, mirror_y, pgm)) {
+    tileHashesValid = false;
+    _writeImage(0x24, bitmap, x, y, w, h, invert, mirror_y, pgm);
+    return;
+  }
+  bool limited = tiles != ALL_TILES && frameKnown();
+  uint32_t crc = limited ? 0 : _frameCrc(bitmap);
+  if (!limited && !_initial_write && tileHashesValid && frameCrcValid &&
+      crc == frameCrc) {
+    // the panel already shows this frame. leave the controller alone, so the
+    // refresh and the booster power on are skipped too.
+    _dirtyPending                 = true;
+    _dirtyCount                   = 0;
+    displayStats.lastFrameBytes   = 0;
+    displayStats.lastFrameMicros  = 0;
+    displayStats.lastFrameWindows = 0;
+    displayStats.framesSkipped++;
+    return;
+  }
+  uint32_t bytesBefore = displayStats.bytesSent;
+  uint32_t start       = micros();
+  displayStats.frames++;
+  if (_initial_write || !tileHashesValid) {
+    _writeImage(0x24, bitmap, x, y, w, h, invert, mirror_y, pgm);
+    _storeTileHashes(bitmap);
+    displayStats.lastFrameWindows = 1;
+  } else {
+    _writeDirtyTiles(0x24, bitmap, limited ? tiles : ALL_TILES);
+    frameCrc                      = crc;
+    frameCrcValid                 = !limited;
+    displayStats.lastFrameWindows = _dirtyCount;
+  }
+  displayStats.lastFrameBytes  = displayStats.bytesSent - bytesBefore;
+  displayStats.lastFrameMicros = micros() - start;
 }
 
 void WatchyDisplay::writeImageForFullRefresh(const uint8_t bitmap[], int16_t x,
                                              int16_t y, int16_t w, int16_t h,
                                              bool invert, bool mirror_y,
                                              bool pgm) {
+  waitRefresh();
+  _dirtyPending  = false;
+  _tileLimit     = ALL_TILES;
+  uint32_t start = micros();
   _writeImage(0x26, bitmap, x, y, w, h, invert, mirror_y, pgm);
   _writeImage(0x24, bitmap, x, y, w, h, invert, mirror_y, pgm);
+  if (_isFullFrame(x, y, w, h, invert, mirror_y, pgm)) {
+    displayStats.frames++;
+    displayStats.lastFrameMicros  = micros() - start;
+    displayStats.lastFrameBytes   = uint32_t(WIDTH) * uint32_t(HEIGHT) / 4;
+    displayStats.lastFrameWindows = 1;
+    _storeTileHashes(bitmap);
+  } else {
+    tileHashesValid = false;
+  }
 }
 
 void WatchyDisplay::writeImageAgain(const uint8_t bitmap[], int16_t x,
                                     int16_t y, int16_t w, int16_t h,
                                     bool invert, bool mirror_y, bool pgm) {
+  if (_refreshPending && _againBitmap == nullptr &&
+      _isFullFrame(x, y, w, h, invert, mirror_y, pgm)) {
+    // the controller is busy with the refresh, write once it is done. the
+    // caller may draw the next frame into bitmap meanwhile, so what is going
+    // to be written is copied out now.
+    _copyAgain(bitmap);
+    _againBitmap = _againCopy;
+    return;
+  }
+  waitRefresh();
+  if (_dirtyPending && _isFullFrame(x, y, w, h, invert, mirror_y, pgm)) {
+    // only the dirty windows differ from what the controller already has.
+    _writeDirtyWindows(0x24, bitmap);
+    _dirtyPending = false;
+    return;
+  }
   _writeImage(0x24, bitmap, x, y, w, h, invert, mirror_y, pgm);
 }
 
+bool WatchyDisplay::_isFullFrame(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 bool invert, bool mirror_y, bool pgm) {
+  return x == 0 && y == 0 && w == int16_t(WIDTH) && h == int16_t(HEIGHT) &&
+         !invert && !mirror_y && !pgm;
+}
+
+void WatchyDisplay::_copyAgain(const uint8_t bitmap[]) {
+  const uint16_t stride = WIDTH / 8;
+  if (!_dirtyPending) {
+    memcpy(_againCopy, bitmap, sizeof(_againCopy));
+    return;
+  }
+  // only the dirty windows are written again, the rest of the copy is unused.
+  for (uint16_t i = 0; i < _dirtyCount; i++) {
+    const Window &d = _dirty[i];
+    for (int16_t row = d.y; row < d.y + d.h; row++) {
+      uint16_t offset = row * stride + d.x / 8;
+      memcpy(_againCopy + offset, bitmap + offset, d.w / 8);
+    }
+  }
+}
+
+static uint32_t _tileHash(const uint8_t bitmap[], uint16_t column,
+                          uint16_t row) {
+  // FNV-1a over the tile's bytes
+  const uint16_t stride = WatchyDisplay::WIDTH / 8;
+  const uint8_t *line   = bitmap + row * WatchyDisplay::TILE_HEIGHT * stride +
+                        column * (WatchyDisplay::TILE_WIDTH / 8);
+
+  uint32_t hash = 2166136261u;
+  for (uint16_t i = 0; i < WatchyDisplay::TILE_HEIGHT; i++) {
+    for (uint16_t j = 0; j < WatchyDisplay::TILE_WIDTH / 8; j++) {
+      hash = (hash ^ line[j]) * 16777619u;
+    }
+    line += stride;
+  }
+  return hash;
+}
+
+uint32_t WatchyDisplay::_frameCrc(const uint8_t bitmap[]) {
+  return crc32_le(0, bitmap, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
+}
+
+void WatchyDisplay::_storeTileHashes(const uint8_t bitmap[]) {
+  frameCrc      = _frameCrc(bitmap);
+  frameCrcValid = true;
+  for (uint16_t row = 0; row < TILE_ROWS; row++) {
+    for (uint16_t column = 0; column < TILE_COLUMNS; column++) {
+      tileHashes[row * TILE_COLUMNS + column] = _tileHash(bitmap, column, row);
+    }
+  }
+  tileHashesValid = true;
+}
+
+void WatchyDisplay::_writeDirtyTiles(uint8_t command, const uint8_t bitmap[],
+                                     uint64_t tiles) {
+  // collect runs of changed tiles on each tile row into windows. tiles left
+  // out of tiles are taken as unchanged.
+  _dirtyCount = 0;
+  for (uint16_t row = 0; row < TILE_ROWS; row++) {
+    int16_t runStart = -1;
+    for (uint16_t column = 0; column <= TILE_COLUMNS; column++) {
+      bool changed = false;
+      if (column < TILE_COLUMNS &&
+          (tiles >> (row * TILE_COLUMNS + column)) & 1) {
+        uint32_t hash = _tileHash(bitmap, column, row);
+        uint32_t *old = &tileHashes[row * TILE_COLUMNS + column];
+        changed       = (hash != *old);
+        *old          = hash;
+      }
+      if (changed && runStart < 0) {
+        runStart = column;
+      } else if (!changed && runStart >= 0) {
+        Window *win = &_dirty[_dirtyCount++];
+        win->x      = runStart * TILE_WIDTH;
+        win->y      = row * TILE_HEIGHT;
+        win->w      = (column - runStart) * TILE_WIDTH;
+        win->h      = TILE_HEIGHT;
+        runStart    = -1;
+      }
+    }
+  }
+  _dirtyPending = true;
+  _writeDirtyWindows(command, bitmap);
+}
+
+void WatchyDisplay::_writeDirtyWindows(uint8_t command,
+                                       const uint8_t bitmap[]) {
+  for (uint16_t i = 0; i < _dirtyCount; i++) {
+    _writeImagePart(command, bitmap, _dirty[i].x, _dirty[i].y, WIDTH, HEIGHT,
+                    _dirty[i].x, _dirty[i].y, _dirty[i].w, _dirty[i].h);
+  }
+  displayStats.windowsSent += _dirtyCount;
+}
+
+void WatchyDisplay::_refreshDirtyWindows() {
+  if (_dirtyCount == 0) {
+    // the controller already shows this frame.
+    return;
+  }
+  // a partial refresh costs the same waveform time regardless of its size, so
+  // refresh the bounding box of all dirty windows at once.
+  int16_t x1 = WIDTH, y1 = HEIGHT, x2 = 0, y2 = 0;
+  for (uint16_t i = 0; i < _dirtyCount; i++) {
+    if (_dirty[i].x < x1)
+      x1 = _dirty[i].x;
+    if (_dirty[i].y < y1)
+      y1 = _dirty[i].y;
+    if (_dirty[i].x + _dirty[i].w > x2)
+      x2 = _dirty[i].x + _dirty[i].w;
+    if (_dirty[i].y + _dirty[i].h > y2)
+      y2 = _dirty[i].y + _dirty[i].h;
+  }
+  refresh(x1, y1, x2 - x1, y2 - y1);
+}
+
 void WatchyDisplay::_writeImage(uint8_t command, const uint8_t bitmap[],
                                 int16_t x, int16_t y, int16_t w, int16_t h,
                                 bool invert, bool mirror_y, bool pgm) {
+  _ensureAwake();
   if (_initial_write)
     writeScreenBuffer(); // initial full screen buffer clean
 #if defined(ESP8266) || defined(ESP32)
@@ -139,37 +382,53 @@ void WatchyDisplay::_writeImage(uint8_t command, const uint8_t bitmap[],
   _setPartialRamArea(x1, y1, w1, h1);
   _startTransfer();
   _transferCommand(command);
-  for (int16_t i = 0; i < h1; i++) {
-    for (int16_t j = 0; j < w1 / 8; j++) {
-      uint8_t data;
+  if (w1 == w && !invert && !mirror_y && !pgm) {
+    // whole bitmap rows are contiguous, so send the window in one go.
+    SPI.writeBytes(&bitmap[dy * wb], uint32_t(h1) * uint32_t(wb));
+  } else {
+    for (int16_t i = 0; i < h1; i++) {
       // use wb, h of bitmap for index!
-      int16_t idx = mirror_y ? j + dx / 8 + ((h - 1 - (i + dy))) * wb
-                             : j + dx / 8 + (i + dy) * wb;
-      if (pgm) {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      } else {
-        data = bitmap[idx];
-      }
-      if (invert)
-        data = ~data;
-      _transfer(data);
+      int16_t row = mirror_y ? h - 1 - (i + dy) : i + dy;
+      _transferRow(&bitmap[dx / 8 + row * wb], w1 / 8, invert, pgm);
     }
   }
   _endTransfer();
+  displayStats.bytesSent += uint32_t(h1) * uint32_t(w1 / 8);
 #if defined(ESP8266) || defined(ESP32)
   yield(); // avoid wdt
 #endif
 }
 
+void WatchyDisplay::_transferRow(const uint8_t *data, int16_t bytes,
+                                 bool invert, bool pgm) {
+  if (pgm) {
+    for (int16_t j = 0; j < bytes; j++) {
+#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
+      uint8_t value = pgm_read_byte(&data[j]);
+#else
+      uint8_t value = data[j];
+#endif
+      _transfer(invert ? ~value : value);
+    }
+    return;
+  }
+  if (!invert) {
+    SPI.writeBytes(data, bytes);
+    return;
+  }
+  uint8_t row[WIDTH / 8];
+  for (int16_t j = 0; j < bytes; j++) {
+    row[j] = ~data[j];
+  }
+  SPI.writeBytes(row, bytes);
+}
+
 void WatchyDisplay::writeImagePart(const uint8_t bitmap[], int16_t x_part,
                                    int16_t y_part, int16_t w_bitmap,
                                    int16_t h_bitmap, int16_t x, int16_t y,
                                    int16_t w, int16_t h, bool invert,
                                    bool mirror_y, bool pgm) {
+  waitRefresh();
   _writeImagePart(0x24, bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h,
                   invert, mirror_y, pgm);
 }
@@ -179,6 +438,7 @@ void WatchyDisplay::writeImagePartAgain(const uint8_t bitmap[], int16_t x_part,
                                         int16_t h_bitmap, int16_t x, int16_t y,
                                         int16_t w, int16_t h, bool invert,
                                         bool mirror_y, bool pgm) {
+  waitRefresh();
   _writeImagePart(0x24, bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h,
                   invert, mirror_y, pgm);
 }
@@ -188,6 +448,7 @@ void WatchyDisplay::_writeImagePart(uint8_t command, const uint8_t bitmap[],
                                     int16_t w_bitmap, int16_t h_bitmap,
                                     int16_t x, int16_t y, int16_t w, int16_t h,
                                     bool invert, bool mirror_y, bool pgm) {
+  _ensureAwake();
   if (_initial_write)
     writeScreenBuffer(); // initial full screen buffer clean
 #if defined(ESP8266) || defined(ESP32)
@@ -220,29 +481,21 @@ void WatchyDisplay::_writeImagePart(uint8_t command, const uint8_t bitmap[],
   _setPartialRamArea(x1, y1, w1, h1);
   _startTransfer();
   _transferCommand(command);
-  for (int16_t i = 0; i < h1; i++) {
-    for (int16_t j = 0; j < w1 / 8; j++) {
-      uint8_t data;
+  if (x_part == 0 && w1 == wb_bitmap * 8 && !invert && !mirror_y && !pgm) {
+    // whole bitmap rows are contiguous, so send the window in one go.
+    SPI.writeBytes(&bitmap[(y_part + dy) * wb_bitmap],
+                   uint32_t(h1) * uint32_t(wb_bitmap));
+  } else {
+    for (int16_t i = 0; i < h1; i++) {
       // use wb_bitmap, h_bitmap of bitmap for index!
-      int16_t idx =
-          mirror_y ? x_part / 8 + j + dx / 8 +
-                         ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap
-                   : x_part / 8 + j + dx / 8 + (y_part + i + dy) * wb_bitmap;
-      if (pgm) {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      } else {
-        data = bitmap[idx];
-      }
-      if (invert)
-        data = ~data;
-      _transfer(data);
+      int16_t row = mirror_y ? h_bitmap - 1 - (y_part + i + dy)
+                             : y_part + i + dy;
+      _transferRow(&bitmap[x_part / 8 + dx / 8 + row * wb_bitmap], w1 / 8,
+                   invert, pgm);
     }
   }
   _endTransfer();
+  displayStats.bytesSent += uint32_t(h1) * uint32_t(w1 / 8);
 #if defined(ESP8266) || defined(ESP32)
   yield(); // avoid wdt
 #endif
@@ -323,18 +576,26 @@ void WatchyDisplay::drawNative(const uint8_t *data1, const uint8_t *data2,
 }
 
 void WatchyDisplay::refresh(bool partial_update_mode) {
-  if (partial_update_mode)
+  waitRefresh();
+  if (refreshProfile == REFRESH_QUALITY)
+    partial_update_mode = false;
+  if (partial_update_mode && _dirtyPending && !_initial_refresh)
+    _refreshDirtyWindows();
+  else if (partial_update_mode)
     refresh(0, 0, WIDTH, HEIGHT);
   else {
+    _ensureAwake();
     if (_using_partial_mode)
       _Init_Full();
     _Update_Full();
     _initial_refresh = false; // initial full update done
   }
+  refreshProfile = REFRESH_PARTIAL;
 }
 
 void WatchyDisplay::refresh(int16_t x, int16_t y, int16_t w, int16_t h) {
-  if (_initial_refresh)
+  waitRefresh();
+  if (_initial_refresh || refreshProfile == REFRESH_QUALITY)
     return refresh(false); // initial update needs be full update
   // intersection with screen
   int16_t w1 = x < 0 ? w + x : w;                                     // reduce
@@ -350,17 +611,63 @@ void WatchyDisplay::refresh(int16_t x, int16_t y, int16_t w, int16_t h) {
   if (w1 % 8 > 0)
     w1 += 8 - w1 % 8;
   x1 -= x1 % 8;
+  _ensureAwake();
   if (!_using_partial_mode)
     _Init_Part();
   _setPartialRamArea(x1, y1, w1, h1);
   _Update_Part();
+  displayStats.windowsRefreshed++;
+  displayStats.partialsSinceFull++;
+  displayStats.pixelsSinceFull += uint32_t(w1) * uint32_t(h1);
+  refreshProfile = REFRESH_PARTIAL;
+}
+
+void WatchyDisplay::refreshAsync(bool partial_update_mode) {
+  bool async   = asyncRefresh;
+  asyncRefresh = true;
+  refresh(partial_update_mode);
+  asyncRefresh = async;
+}
+
+void WatchyDisplay::waitRefresh() {
+  if (!_refreshPending)
+    return;
+  _refreshPending = false;
+  if (digitalRead(_busy) == _busy_level) {
+    ProfileScope phase(PHASE_REFRESH);
+    _waitWhileBusy(_refreshName, _refreshTime);
+    // only timed when still busy here, otherwise the end is unknown.
+    displayStats.busyMicros[_refreshKind] = micros() - _refreshStart;
+  }
+  if (_againBitmap != nullptr) {
+    const uint8_t *bitmap = _againBitmap;
+    _againBitmap          = nullptr;
+    writeImageAgain(bitmap, 0, 0, WIDTH, HEIGHT);
+  }
+  if (_powerOffPending) {
+    _powerOffPending = false;
+    _PowerOff();
+  }
+}
+
+bool WatchyDisplay::isRefreshing() {
+  return _refreshPending && digitalRead(_busy) == _busy_level;
 }
 
-void WatchyDisplay::powerOff() { _PowerOff(); }
+void WatchyDisplay::powerOff() {
+  if (_refreshPending) {
+    _powerOffPending = true;
+    return;
+  }
+  if (_awake)
+    _PowerOff();
+}
 
 void WatchyDisplay::hibernate() {
   //_PowerOff(); // Not needed before entering deep sleep
-  if (_rst >= 0) {
+  waitRefresh();
+  // a controller that was never woken is still in deep sleep from last time.
+  if (_awake && _rst >= 0) {
     _writeCommand(0x10); // deep sleep mode
     _writeData(0x1);     // enter deep sleep
     _hibernating = true;
@@ -401,6 +708,7 @@ void WatchyDisplay::_PowerOnAsync() {
 }
 
 void WatchyDisplay::_PowerOn() {
+  ProfileScope phase(PHASE_PANEL);
   if (waitingPowerOn) {
     waitingPowerOn = false;
     _waitWhileBusy("_PowerOn", power_on_time);
@@ -463,6 +771,7 @@ void WatchyDisplay::_InitDisplay() {
   _transferCommand(0x18); // Read built-in temperature sensor
   _transfer(0x80);
   _endTransfer();
+  _fastLutLoaded = false;
 
   setDarkBorder(darkBorder);
 
@@ -503,18 +812,66 @@ void WatchyDisplay::_Update_Full() {
   _transfer(0xf4);
   _transferCommand(0x20);
   _endTransfer();
-  _waitWhileBusy("_Update_Full", full_refresh_time);
-  displayFullInit = false;
+  _fastLutLoaded = false; // replaced by the one loaded from OTP
+  _waitUpdate("_Update_Full", full_refresh_time, REFRESH_QUALITY);
+  displayFullInit                = false;
+  displayStats.partialsSinceFull = 0;
+  displayStats.pixelsSinceFull   = 0;
 }
 
 void WatchyDisplay::_Update_Part() {
+  if (refreshProfile == REFRESH_FAST) {
+    _loadFastLut();
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xcc); // skip temperature and LUT load, keep the fast LUT
+    _transferCommand(0x20);
+    _endTransfer();
+    _waitUpdate("_Update_Part", fast_refresh_time, REFRESH_FAST);
+    return;
+  }
   _startTransfer();
   _transferCommand(0x22);
-  //_transfer(0xcc); // skip temperature load (-5ms)
   _transfer(0xfc);
   _transferCommand(0x20);
   _endTransfer();
-  _waitWhileBusy("_Update_Part", partial_refresh_time);
+  _fastLutLoaded = false; // replaced by the one loaded from OTP
+  _waitUpdate("_Update_Part", partial_refresh_time, REFRESH_PARTIAL);
+}
+
+void WatchyDisplay::_loadFastLut() {
+  if (_fastLutLoaded)
+    return;
+  _startTransfer();
+  _transferCommand(0x32); // write LUT register
+  SPI.writeBytes(fastLut, 153);
+  _transferCommand(0x3f); // end option
+  _transfer(fastLut[153]);
+  _transferCommand(0x03); // gate driving voltage
+  _transfer(fastLut[154]);
+  _transferCommand(0x04); // source driving voltage
+  _transfer(fastLut[155]);
+  _transfer(fastLut[156]);
+  _transfer(fastLut[157]);
+  _transferCommand(0x2c); // VCOM
+  _transfer(fastLut[158]);
+  _endTransfer();
+  _fastLutLoaded = true;
+}
+
+void WatchyDisplay::_waitUpdate(const char *comment, uint16_t busy_time,
+                                RefreshProfile profile) {
+  _refreshStart = micros();
+  _refreshKind  = profile;
+  if (!asyncRefresh) {
+    ProfileScope phase(PHASE_REFRESH);
+    _waitWhileBusy(comment, busy_time);
+    displayStats.busyMicros[profile] = micros() - _refreshStart;
+    return;
+  }
+  _refreshPending = true;
+  _refreshName    = comment;
+  _refreshTime    = busy_time;
 }
 
 void WatchyDisplay::_transferCommand(uint8_t value) {
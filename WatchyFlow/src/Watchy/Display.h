@@ -24,6 +24,29 @@
 #include "driver/gpio.h"
 #include "config.h"
 
+typedef enum RefreshProfile {
+  REFRESH_QUALITY = 0, // full refresh, clears ghosting
+  REFRESH_PARTIAL = 1, // the controller's own partial waveform
+  REFRESH_FAST    = 2, // short custom waveform, no temperature reload
+} RefreshProfile;
+
+#define REFRESH_PROFILE_COUNT 3
+
+typedef struct DisplayStats {
+  uint32_t frames;           // full frames handed to the controller
+  uint32_t bytesSent;        // image bytes sent over SPI
+  uint32_t windowsSent;      // dirty windows written to controller memory
+  uint32_t windowsRefreshed; // partial refresh windows
+  uint32_t framesSkipped;    // frames identical to the one on the panel
+  uint32_t partialsSinceFull; // partial refreshes since the last full one
+  uint32_t pixelsSinceFull;   // pixels driven by those partial refreshes
+  uint32_t lastFrameBytes;
+  uint32_t lastFrameMicros; // time spent writing the last frame over SPI
+  uint16_t lastFrameWindows;
+  // last measured panel busy time for each refresh profile
+  uint32_t busyMicros[REFRESH_PROFILE_COUNT];
+} DisplayStats;
+
 class WatchyDisplay : public GxEPD2_EPD {
 public:
   // attributes
@@ -38,14 +61,34 @@ public:
   static const uint16_t power_off_time       = 150;  // ms, e.g. 140621us
   static const uint16_t full_refresh_time    = 2600; // ms, e.g. 2509602us
   static const uint16_t partial_refresh_time = 500;  // ms, e.g. 457282us
+  static const uint16_t fast_refresh_time    = 300;  // ms
+  // the panel keeps the last frame in controller memory across deep sleep, so
+  // full frame writes are diffed against a per-tile hash of that frame and
+  // only the changed tiles are resent. tiles must be byte aligned.
+  static const uint16_t TILE_WIDTH   = 40;
+  static const uint16_t TILE_HEIGHT  = 20;
+  static const uint16_t TILE_COLUMNS = WIDTH / TILE_WIDTH;
+  static const uint16_t TILE_ROWS    = HEIGHT / TILE_HEIGHT;
+  static const uint16_t TILE_COUNT   = TILE_COLUMNS * TILE_ROWS;
+  static const uint64_t ALL_TILES    = (1ULL << TILE_COUNT) - 1;
   // constructor
   WatchyDisplay();
+  // brings the controller up. not needed before drawing, every method that
+  // talks to the controller does this on first use, so wakes that leave the
+  // panel alone never reset or power it.
   void initWatchy();
+  bool awake() { return _awake; }
   void setDarkBorder(bool darkBorder);
   void asyncPowerOn();
   void _PowerOnAsync();
   bool waitingPowerOn = false;
   static void busyCallback(const void *);
+  // called each time a busy wait wakes from light sleep, e.g. because a
+  // button armed as a wakeup source was pressed.
+  static void (*whileBusy)();
+  // busy waits light sleep until the panel is done. that stops the radio
+  // too, so it is turned off while WiFi is up and the waits poll instead.
+  static bool sleepWhileBusy;
   // methods (virtual)
   //  Support for Bitmaps (Sprites) to Controller Buffer and to Screen
   void
@@ -119,6 +162,12 @@ public:
   void
   refresh(int16_t x, int16_t y, int16_t w,
           int16_t h); // screen refresh from controller memory, partial screen
+  // starts a screen refresh like refresh() but returns while the panel is
+  // still updating. the wait happens before the next controller command or
+  // hibernate, so other work can overlap with the update.
+  void refreshAsync(bool partial_update_mode = false);
+  void waitRefresh(); // blocks until a refresh started asynchronously is done
+  bool isRefreshing();
   void powerOff();    // turns off generation of panel driving voltages, avoids
                       // screen fading over time
   void hibernate();   // turns powerOff() and sets controller to deep sleep for
@@ -126,6 +175,22 @@ public:
 
   bool darkBorder = false; // adds a dark border outside the normal screen area
 
+  bool asyncRefresh = false; // every refresh behaves like refreshAsync
+  // profile for the next refresh. it goes back to REFRESH_PARTIAL after every
+  // refresh, so it has to be picked again for each frame.
+  RefreshProfile refreshProfile = REFRESH_PARTIAL;
+
+  static const DisplayStats &stats();
+
+  // the controller holds the last full frame written, so the next one can be
+  // sent as only some of its tiles.
+  bool frameKnown();
+  // limits the next full frame write to these tiles, bit row * TILE_COLUMNS +
+  // column. the rest of the bitmap is not looked at and the panel keeps what
+  // it shows there, so only the limited tiles have to be drawn. only for
+  // partial updates while frameKnown().
+  void limitNextFrame(uint64_t tiles) { _tileLimit = tiles; }
+
   static constexpr bool reduceBoosterTime = true; // Saves ~200ms
 private:
   void _writeScreenBuffer(uint8_t command, uint8_t value);
@@ -137,7 +202,17 @@ private:
                        int16_t x, int16_t y, int16_t w, int16_t h,
                        bool invert = false, bool mirror_y = false,
                        bool pgm = false);
+  void _transferRow(const uint8_t *data, int16_t bytes, bool invert, bool pgm);
   void _setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+  bool _isFullFrame(int16_t x, int16_t y, int16_t w, int16_t h, bool invert,
+                    bool mirror_y, bool pgm);
+  void _writeDirtyTiles(uint8_t command, const uint8_t bitmap[],
+                        uint64_t tiles);
+  void _writeDirtyWindows(uint8_t command, const uint8_t bitmap[]);
+  void _copyAgain(const uint8_t bitmap[]);
+  void _refreshDirtyWindows();
+  void _storeTileHashes(const uint8_t bitmap[]);
+  uint32_t _frameCrc(const uint8_t bitmap[]);
   void _PowerOn();
   void _PowerOff();
   void _InitDisplay();
@@ -145,8 +220,36 @@ private:
   void _Init_Part();
   void _Update_Full();
   void _Update_Part();
+  void _waitUpdate(const char *comment, uint16_t busy_time,
+                   RefreshProfile profile);
+  void _loadFastLut();
 
   void _reset();
 
   void _transferCommand(uint8_t command);
+  void _ensureAwake();
+
+  typedef struct Window {
+    int16_t x, y, w, h;
+  } Window;
+
+  bool _awake         = false;
+  bool _fastLutLoaded = false;
+  uint64_t _tileLimit = ALL_TILES;
+  // an asynchronous refresh is running. writeImageAgain and powerOff calls
+  // made meanwhile are held until it is done.
+  bool _refreshPending        = false;
+  const char *_refreshName    = nullptr;
+  uint16_t _refreshTime       = 0;
+  RefreshProfile _refreshKind = REFRESH_PARTIAL;
+  uint32_t _refreshStart      = 0;
+  const uint8_t *_againBitmap = nullptr;
+  // what a held writeImageAgain writes, copied from the caller's bitmap.
+  uint8_t _againCopy[WIDTH * HEIGHT / 8];
+  bool _powerOffPending       = false;
+  // set by a diffed full frame write until the matching refresh and
+  // writeImageAgain are done.
+  bool _dirtyPending   = false;
+  uint16_t _dirtyCount = 0;
+  Window _dirty[TILE_ROWS * ((TILE_COLUMNS + 1) / 2)];
 };
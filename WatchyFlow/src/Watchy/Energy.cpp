@@ -0,0 +1,174 @@
+#include "Energy.h"
+#include <TimeLib.h>
+
+// typical Watchy figures, in microamps
+#define DEFAULT_CPU_UA        40000
+#define DEFAULT_BUSY_UA       1000
+#define DEFAULT_WIFI_UA       110000
+#define DEFAULT_DISPLAY_UA    4000
+#define DEFAULT_DEEP_SLEEP_UA 150
+#define DEFAULT_BATTERY_MAH   200
+
+#define MIN_PROJECTION_SECONDS (60 * 60)
+
+typedef struct EnergyState {
+  time_t since;    // when accounting started
+  time_t lastWake; // when the last wake began
+  uint32_t lastActiveMicros;
+  float totalMah;
+  float sleepMah;
+  float reasonMah[Energy::REASONS];
+  const char *appNames[Energy::APPS];
+  float appMah[Energy::APPS];
+  uint32_t days[Energy::DAYS];
+  float dayMah[Energy::DAYS];
+} EnergyState;
+
+RTC_DATA_ATTR EnergyState energy;
+
+static EnergyModel model;
+static uint32_t today;
+static const char *currentApp;
+
+static uint32_t orDefault(uint32_t value, uint32_t fallback) {
+  return value != 0 ? value : fallback;
+}
+
+// microamps over microseconds, in mAh
+static float microMah(uint32_t micros, uint32_t microAmps) {
+  return float(micros) * float(microAmps) / 3.6e12f;
+}
+
+static void charge(float mah) {
+  energy.totalMah += mah;
+  uint8_t i = today % Energy::DAYS;
+  if (energy.days[i] != today) {
+    energy.days[i]   = today;
+    energy.dayMah[i] = 0;
+  }
+  energy.dayMah[i] += mah;
+}
+
+static uint32_t phaseMicroAmps(uint8_t phase) {
+  switch (phase) {
+  case PHASE_PANEL:
+  case PHASE_REFRESH:
+    return model.busyMicroAmps + model.displayMicroAmps;
+  case PHASE_IDLE:
+    return model.busyMicroAmps;
+  case PHASE_WIFI:
+  case PHASE_FETCH:
+  case PHASE_NTP:
+    return model.wifiMicroAmps;
+  default:
+    return model.cpuMicroAmps;
+  }
+}
+
+void Energy::reset() { memset(&energy, 0, sizeof(energy)); }
+
+void Energy::begin(const EnergyModel &settings, time_t now, uint32_t day) {
+  model.cpuMicroAmps  = orDefault(settings.cpuMicroAmps, DEFAULT_CPU_UA);
+  model.busyMicroAmps = orDefault(settings.busyMicroAmps, DEFAULT_BUSY_UA);
+  model.wifiMicroAmps = orDefault(settings.wifiMicroAmps, DEFAULT_WIFI_UA);
+  model.displayMicroAmps =
+      orDefault(settings.displayMicroAmps, DEFAULT_DISPLAY_UA);
+  model.deepSleepMicroAmps =
+      orDefault(settings.deepSleepMicroAmps, DEFAULT_DEEP_SLEEP_UA);
+  model.batteryMah = orDefault(settings.batteryMah, DEFAULT_BATTERY_MAH);
+  today            = day;
+
+  if (energy.since == 0) {
+    energy.since    = now;
+    energy.lastWake = now;
+    return;
+  }
+  // the clock only has seconds, and may have been set since.
+  float asleep = float(now - energy.lastWake) -
+                 float(energy.lastActiveMicros) / 1000000.0f;
+  if (asleep > 0) {
+    float mah = asleep * float(model.deepSleepMicroAmps) / 3.6e6f;
+    energy.sleepMah += mah;
+    charge(mah);
+  }
+  energy.lastWake = now;
+}
+
+void Energy::setApp(const char *name) { currentApp = name; }
+
+void Energy::finish(const WakeProfile &wake) {
+  float mah = wakeMah(wake);
+  charge(mah);
+  if (wake.reason < REASONS) {
+    energy.reasonMah[wake.reason] += mah;
+  }
+
+  const char *name = currentApp != nullptr ? currentApp : "other";
+  uint8_t i        = 0;
+  for (; i < APPS - 1 && energy.appNames[i] != nullptr; i++) {
+    if (strcmp(energy.appNames[i], name) == 0) {
+      break;
+    }
+  }
+  if (energy.appNames[i] == nullptr) {
+    energy.appNames[i] = name;
+  } else if (strcmp(energy.appNames[i], name) != 0) {
+    // out of slots, the last one collects the rest.
+    energy.appNames[i] = "other";
+  }
+  energy.appMah[i] += mah;
+
+  energy.lastActiveMicros = 0;
+  for (uint8_t phase = 0; phase < PROFILE_PHASE_COUNT; phase++) {
+    energy.lastActiveMicros += wake.micros[phase];
+  }
+}
+
+float Energy::wakeMah(const WakeProfile &wake) {
+  float mah = 0;
+  for (uint8_t phase = 0; phase < PROFILE_PHASE_COUNT; phase++) {
+    mah += microMah(wake.micros[phase], phaseMicroAmps(phase));
+  }
+  return mah;
+}
+
+float Energy::reasonMah(uint8_t reason) {
+  return reason < REASONS ? energy.reasonMah[reason] : 0;
+}
+
+float Energy::sleepMah() { return energy.sleepMah; }
+
+float Energy::totalMah() { return energy.totalMah; }
+
+float Energy::dayMah(uint8_t daysAgo) {
+  if (daysAgo >= DAYS || daysAgo > today) {
+    return 0;
+  }
+  uint32_t day = today - daysAgo;
+  uint8_t i    = day % DAYS;
+  return energy.days[i] == day ? energy.dayMah[i] : 0;
+}
+
+uint8_t Energy::apps() {
+  uint8_t n = 0;
+  while (n < APPS && energy.appNames[n] != nullptr) {
+    n++;
+  }
+  return n;
+}
+
+EnergyUse Energy::app(uint8_t i) {
+  EnergyUse use = {energy.appNames[i], energy.appMah[i]};
+  return use;
+}
+
+float Energy::projectedDays() {
+  time_t elapsed = energy.lastWake - energy.since;
+  if (elapsed < MIN_PROJECTION_SECONDS || energy.totalMah <= 0) {
+    return 0;
+  }
+  float perDay = energy.totalMah * SECS_PER_DAY / float(elapsed);
+  return float(model.batteryMah) / perDay;
+}
+
+uint16_t Energy::batteryMah() { return model.batteryMah; }
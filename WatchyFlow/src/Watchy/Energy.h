@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Arduino.h>
+#include "Settings.h"
+#include "Profiler.h"
+
+typedef struct EnergyUse {
+  const char *name;
+  float mah;
+} EnergyUse;
+
+// estimates where the battery goes. the phase timings of each wake are
+// multiplied by the modeled current draw of that phase, and the time between
+// wakes by the deep sleep current. totals per wakeup reason, app and day are
+// kept in RTC memory until the next reset.
+class Energy {
+public:
+  static const uint8_t DAYS    = 7;
+  static const uint8_t APPS    = 6;
+  static const uint8_t REASONS = 5; // WakeupReason
+
+  static void reset();
+  // at the start of a wake. charges the deep sleep since the last one.
+  static void begin(const EnergyModel &model, time_t now, uint32_t day);
+  // the app that was shown, or nullptr.
+  static void setApp(const char *name);
+  // charges a finished wake to its reason, the app and today.
+  static void finish(const WakeProfile &wake);
+
+  static float wakeMah(const WakeProfile &wake);
+  static float reasonMah(uint8_t reason);
+  static float sleepMah();
+  static float totalMah();
+  static float dayMah(uint8_t daysAgo); // 0 is today
+  static uint8_t apps();
+  static EnergyUse app(uint8_t i);
+
+  // how many days a full battery lasts at the rate so far, or 0 while there
+  // isn't an hour of data yet.
+  static float projectedDays();
+  static uint16_t batteryMah();
+};
@@ -0,0 +1,426 @@
+#include "Framebuffer.h"
+#include "Profiler.h"
+
+// the built-in font, as Adafruit_GFX has it.
+#include <glcdfont.c>
+
+static const int16_t SCREEN_WIDTH  = WatchyDisplay::WIDTH;
+static const int16_t SCREEN_HEIGHT = WatchyDisplay::HEIGHT;
+
+// bits from bit x of a byte to the end of it
+static inline uint8_t maskFrom(uint8_t x) { return 0xFF >> x; }
+// bits up to, but not including, bit x of a byte
+static inline uint8_t maskTo(uint8_t x) { return ~(0xFF >> x); }
+
+static inline uint8_t reverseByte(uint8_t b) {
+  b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+  b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+  b = (b & 0xAA) >> 1 | (b & 0x55) << 1;
+  return b;
+}
+
+// the tallest glyph drawn from column data, in bytes
+static const uint8_t MAX_COLUMN_BYTES = 8;
+
+void Framebuffer::display(bool partial_update_mode) {
+  ProfileScope phase(PHASE_SPI);
+  if (partial_update_mode) {
+    epd2.writeImage(buffer_, 0, 0, WatchyDisplay::WIDTH,
+                    WatchyDisplay::HEIGHT);
+  } else {
+    epd2.writeImageForFullRefresh(buffer_, 0, 0, WatchyDisplay::WIDTH,
+                                  WatchyDisplay::HEIGHT);
+  }
+  epd2.refresh(partial_update_mode);
+  epd2.writeImageAgain(buffer_, 0, 0, WatchyDisplay::WIDTH,
+                       WatchyDisplay::HEIGHT);
+  if (!partial_update_mode) {
+    epd2.powerOff();
+  }
+}
+
+void Framebuffer::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || x >= width() || y < 0 || y >= height()) {
+    return;
+  }
+  int16_t swap;
+  switch (getRotation()) {
+  case 1:
+    swap = x;
+    x    = SCREEN_WIDTH - y - 1;
+    y    = swap;
+    break;
+  case 2:
+    x = SCREEN_WIDTH - x - 1;
+    y = SCREEN_HEIGHT - y - 1;
+    break;
+  case 3:
+    swap = x;
+    x    = y;
+    y    = SCREEN_HEIGHT - swap - 1;
+    break;
+  }
+  if (x < clipX_ || x >= clipX_ + clipW_ || y < clipY_ ||
+      y >= clipY_ + clipH_) {
+    return;
+  }
+  pixelsWritten_++;
+  uint8_t *b = &buffer_[y * ROW_BYTES + x / 8];
+  if (color == GxEPD_BLACK) {
+    *b &= ~(0x80 >> (x & 7));
+  } else {
+    *b |= 0x80 >> (x & 7);
+  }
+}
+
+void Framebuffer::fillScreen(uint16_t color) {
+  if (clipped_) {
+    for (int16_t row = clipY_; row < clipY_ + clipH_; row++) {
+      fillSpan(clipX_, row, clipW_, color != GxEPD_BLACK);
+    }
+    return;
+  }
+  memset(buffer_, color == GxEPD_BLACK ? 0x00 : 0xFF, sizeof(buffer_));
+  pixelsWritten_ += uint32_t(SCREEN_WIDTH) * SCREEN_HEIGHT;
+}
+
+void Framebuffer::setClip(int16_t x, int16_t y, int16_t w, int16_t h) {
+  clearClip();
+  if (!toBuffer(&x, &y, &w, &h)) {
+    w = 0;
+    h = 0;
+  }
+  clipped_ = true;
+  clipX_   = x;
+  clipY_   = y;
+  clipW_   = w;
+  clipH_   = h;
+}
+
+void Framebuffer::clearClip() {
+  clipped_ = false;
+  clipX_   = 0;
+  clipY_   = 0;
+  clipW_   = SCREEN_WIDTH;
+  clipH_   = SCREEN_HEIGHT;
+}
+
+bool Framebuffer::visible(int16_t x, int16_t y, int16_t w, int16_t h) const {
+  return toBuffer(&x, &y, &w, &h);
+}
+
+bool Framebuffer::toBuffer(int16_t *x, int16_t *y, int16_t *w,
+                           int16_t *h) const {
+  if (*w <= 0 || *h <= 0) {
+    return false;
+  }
+  int16_t x0 = *x, y0 = *y, w0 = *w, h0 = *h;
+  switch (getRotation()) {
+  case 1:
+    *x = SCREEN_WIDTH - y0 - h0;
+    *y = x0;
+    *w = h0;
+    *h = w0;
+    break;
+  case 2:
+    *x = SCREEN_WIDTH - x0 - w0;
+    *y = SCREEN_HEIGHT - y0 - h0;
+    break;
+  case 3:
+    *x = y0;
+    *y = SCREEN_HEIGHT - x0 - w0;
+    *w = h0;
+    *h = w0;
+    break;
+  }
+  if (*x < clipX_) {
+    *w -= clipX_ - *x;
+    *x = clipX_;
+  }
+  if (*y < clipY_) {
+    *h -= clipY_ - *y;
+    *y = clipY_;
+  }
+  if (*x + *w > clipX_ + clipW_) {
+    *w = clipX_ + clipW_ - *x;
+  }
+  if (*y + *h > clipY_ + clipH_) {
+    *h = clipY_ + clipH_ - *y;
+  }
+  return *w > 0 && *h > 0;
+}
+
+void Framebuffer::fillSpan(int16_t x, int16_t y, int16_t w, bool white) {
+  pixelsWritten_ += w;
+
+  uint8_t *b    = &buffer_[y * ROW_BYTES + x / 8];
+  int16_t end   = x + w;
+  uint8_t first = x & 7;
+  uint8_t last  = end & 7;
+  int16_t whole = end / 8 - (x + 7) / 8; // bytes covered completely
+
+  if (first != 0) {
+    uint8_t mask = maskFrom(first);
+    if (x / 8 == end / 8) {
+      // starts and ends inside the same byte
+      mask &= maskTo(last);
+      whole = 0;
+      last  = 0;
+    }
+    *b = white ? (*b | mask) : (*b & ~mask);
+    b++;
+  }
+  if (whole > 0) {
+    memset(b, white ? 0xFF : 0x00, whole);
+    b += whole;
+  }
+  if (last != 0) {
+    uint8_t mask = maskTo(last);
+    *b           = white ? (*b | mask) : (*b & ~mask);
+  }
+}
+
+void Framebuffer::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                           uint16_t color) {
+  if (!toBuffer(&x, &y, &w, &h)) {
+    return;
+  }
+  for (int16_t row = y; row < y + h; row++) {
+    fillSpan(x, row, w, color != GxEPD_BLACK);
+  }
+}
+
+void Framebuffer::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                uint16_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+void Framebuffer::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                uint16_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+void Framebuffer::blitRow(int16_t x, int16_t y, const uint8_t *bits,
+                          uint32_t offset, int16_t w, bool white) {
+  if (y < clipY_ || y >= clipY_ + clipH_) {
+    return;
+  }
+  if (x < clipX_) {
+    offset += clipX_ - x;
+    w -= clipX_ - x;
+    x = clipX_;
+  }
+  if (x + w > clipX_ + clipW_) {
+    w = clipX_ + clipW_ - x;
+  }
+  if (w > 0) {
+    pixelsWritten_ += w;
+  }
+  uint8_t *row = &buffer_[y * ROW_BYTES];
+  while (w > 0) {
+    // the next (up to) 8 source bits, moved to the top of a byte
+    const uint8_t *src = &bits[offset >> 3];
+    uint8_t n          = w < 8 ? w : 8;
+    uint8_t shift      = offset & 7;
+    uint8_t chunk      = src[0] << shift;
+    if (shift + n > 8) {
+      chunk |= src[1] >> (8 - shift);
+    }
+    chunk &= maskTo(n);
+
+    // spread over the one or two buffer bytes they land in
+    uint8_t *b  = &row[x >> 3];
+    uint8_t out = x & 7;
+    uint8_t lo  = chunk >> out;
+    uint8_t hi  = out ? (uint8_t)(chunk << (8 - out)) : 0;
+    if (white) {
+      b[0] |= lo;
+      if (hi) {
+        b[1] |= hi;
+      }
+    } else {
+      b[0] &= ~lo;
+      if (hi) {
+        b[1] &= ~hi;
+      }
+    }
+
+    offset += n;
+    x += n;
+    w -= n;
+  }
+}
+
+void Framebuffer::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                             int16_t w, int16_t h, uint16_t color) {
+  if (getRotation() != 0) {
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+    return;
+  }
+  uint32_t stride = ((w + 7) / 8) * 8;
+  for (int16_t j = 0; j < h; j++) {
+    blitRow(x, y + j, bitmap, j * stride, w, color != GxEPD_BLACK);
+  }
+}
+
+void Framebuffer::addFontColumns(const GFXfont *font,
+                                 const FontColumns *columns) {
+  for (uint8_t i = 0; i < MAX_FONT_COLUMNS; i++) {
+    if (columnFonts_[i] == NULL || columnFonts_[i] == font) {
+      columnFonts_[i] = font;
+      columns_[i]     = columns;
+      return;
+    }
+  }
+}
+
+const FontColumns *Framebuffer::fontColumns(const GFXfont *font) const {
+  for (uint8_t i = 0; i < MAX_FONT_COLUMNS && columnFonts_[i] != NULL; i++) {
+    if (columnFonts_[i] == font) {
+      return columns_[i];
+    }
+  }
+  return NULL;
+}
+
+// the same steps as Adafruit_GFX::write, with the characters themselves
+// drawn by drawClassicChar and drawGlyph. scaled text is left to
+// Adafruit_GFX.
+size_t Framebuffer::write(uint8_t c) {
+  if (textsize_x != 1 || textsize_y != 1) {
+    return Adafruit_GFX::write(c);
+  }
+
+  if (gfxFont == NULL) {
+    if (c == '\n') {
+      cursor_x = 0;
+      cursor_y += 8;
+    } else if (c != '\r') {
+      if (wrap && cursor_x + 6 > _width) {
+        cursor_x = 0;
+        cursor_y += 8;
+      }
+      drawClassicChar(cursor_x, cursor_y, c);
+      cursor_x += 6;
+    }
+    return 1;
+  }
+
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += gfxFont->yAdvance;
+    return 1;
+  }
+  if (c == '\r' || c < gfxFont->first || c > gfxFont->last) {
+    return 1;
+  }
+  // font tables are const data in flash, which the ESP32 reads directly.
+  const GFXglyph *glyph = &gfxFont->glyph[c - gfxFont->first];
+  if (glyph->width > 0 && glyph->height > 0) {
+    if (wrap && cursor_x + glyph->xOffset + glyph->width > _width) {
+      cursor_x = 0;
+      cursor_y += gfxFont->yAdvance;
+    }
+    drawGlyph(cursor_x, cursor_y, c);
+  }
+  cursor_x += glyph->xAdvance;
+  return 1;
+}
+
+// the built-in font is stored a column at a time, low bit at the top, which
+// is a row of the buffer when the text is rotated.
+void Framebuffer::drawClassicChar(int16_t x, int16_t y, uint8_t c) {
+  uint8_t rotation = getRotation();
+  if (textbgcolor != textcolor || rotation == 2) {
+    drawChar(x, y, c, textcolor, textbgcolor, 1);
+    return;
+  }
+  if (!_cp437 && c >= 176) {
+    c++;
+  }
+  const uint8_t *columns = &font[c * 5];
+  bool white             = textcolor != GxEPD_BLACK;
+
+  if (rotation == 0) {
+    for (uint8_t j = 0; j < 8; j++) {
+      uint8_t row = 0;
+      for (uint8_t i = 0; i < 5; i++) {
+        if (columns[i] & (1 << j)) {
+          row |= 0x80 >> i;
+        }
+      }
+      blitRow(x, y + j, &row, 0, 5, white);
+    }
+    return;
+  }
+
+  for (uint8_t i = 0; i < 5; i++) {
+    uint8_t column = columns[i];
+    if (rotation == 1) {
+      // the top of the character is on the right
+      blitRow(SCREEN_WIDTH - y - 8, x + i, &column, 0, 8, white);
+    } else {
+      column = reverseByte(column);
+      blitRow(y, SCREEN_HEIGHT - 1 - x - i, &column, 0, 8, white);
+    }
+  }
+}
+
+void Framebuffer::drawGlyph(int16_t x, int16_t y, uint8_t c) {
+  uint8_t rotation        = getRotation();
+  uint16_t index          = c - gfxFont->first;
+  const GFXglyph *glyph   = &gfxFont->glyph[index];
+  const FontColumns *cols = NULL;
+  int16_t w               = glyph->width;
+  int16_t h               = glyph->height;
+  int16_t gx              = x + glyph->xOffset;
+  int16_t gy              = y + glyph->yOffset;
+  bool white              = textcolor != GxEPD_BLACK;
+
+  if (rotation == 0) {
+    // glyph rows are packed back to back, not padded to whole bytes.
+    const uint8_t *bits = &gfxFont->bitmap[glyph->bitmapOffset];
+    for (int16_t j = 0; j < h; j++) {
+      blitRow(gx, gy + j, bits, (uint32_t)j * w, w, white);
+    }
+    return;
+  }
+
+  if (rotation != 2) {
+    cols = fontColumns(gfxFont);
+  }
+  if (cols == NULL || index >= cols->count || h > 8 * MAX_COLUMN_BYTES) {
+    drawChar(x, y, c, textcolor, textbgcolor, 1);
+    return;
+  }
+
+  const uint8_t *column = &cols->bitmap[cols->offsets[index]];
+  uint8_t bytes         = (h + 7) / 8;
+  for (int16_t i = 0; i < w; i++, column += bytes) {
+    if (rotation == 3) {
+      blitRow(gy, SCREEN_HEIGHT - 1 - gx - i, column, 0, h, white);
+      continue;
+    }
+    // rotation 1 has the top of the glyph on the right, so the column is
+    // written backwards. the padding bits end up first and are skipped.
+    uint8_t reversed[MAX_COLUMN_BYTES];
+    for (uint8_t k = 0; k < bytes; k++) {
+      reversed[k] = reverseByte(column[bytes - 1 - k]);
+    }
+    blitRow(SCREEN_WIDTH - gy - h, gx + i, reversed, bytes * 8 - h, h, white);
+  }
+}
+
+void Display::fillScreen(uint16_t color) {
+  if (powerOnWhileDrawing_) {
+    powerOnWhileDrawing_ = false;
+    epd2.asyncPowerOn();
+  }
+  DisplayBase::fillScreen(color);
+}
+
+void Display::display(bool partial_update_mode) {
+  partial_update_mode   = !fullRefresh(partial_update_mode);
+  fullRefreshScheduled_ = false;
+  DisplayBase::display(partial_update_mode);
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <Adafruit_GFX.h>
+#include "Display.h"
+
+// a GFX font's glyphs stored column by column, for drawing it rotated by 90
+// or 270 degrees a column at a time. generated by font_columns.py.
+typedef struct FontColumns {
+  const uint8_t *bitmap;   // columns, top pixel in the high bit, byte padded
+  const uint16_t *offsets; // where each glyph's first column starts
+  uint16_t count;          // glyphs
+} FontColumns;
+
+// the whole screen as a 1bpp buffer (set bits are white) that is handed to
+// the panel in one piece, in place of GxEPD2_BW. rectangles, lines, bitmaps
+// and GFX font glyphs are written into the buffer a byte at a time with edge
+// masks for unaligned x, instead of one drawPixel call per pixel. text in the
+// built-in font, and in GFX fonts that have column data, is also written
+// directly when rotated by 90 or 270 degrees. anything else goes through
+// Adafruit_GFX and ends up in drawPixel.
+class Framebuffer : public Adafruit_GFX {
+public:
+  static const uint16_t ROW_BYTES = WatchyDisplay::WIDTH / 8;
+
+  Framebuffer() : Adafruit_GFX(WatchyDisplay::WIDTH, WatchyDisplay::HEIGHT) {}
+
+  WatchyDisplay epd2;
+
+  // sends the buffer to the panel and refreshes it.
+  void display(bool partial_update_mode = false);
+  void powerOff() { epd2.powerOff(); }
+  void hibernate() { epd2.hibernate(); }
+
+  const uint8_t *buffer() const { return buffer_; }
+  // pixels covered by drawing since construction, for benchmarks.
+  uint32_t pixelsWritten() const { return pixelsWritten_; }
+
+  // limits drawing to a rectangle, given in the current rotation, until
+  // clearClip. fillScreen only fills the rectangle too, so everything outside
+  // keeps the previous frame and only the rectangle has to be drawn again.
+  void setClip(int16_t x, int16_t y, int16_t w, int16_t h);
+  void clearClip();
+  bool clipped() const { return clipped_; }
+  // whether anything drawn in the rectangle would reach the buffer.
+  bool visible(int16_t x, int16_t y, int16_t w, int16_t h) const;
+
+  // lets text in font be drawn rotated without going pixel by pixel. font
+  // has to be the same pointer that is passed to setFont.
+  void addFontColumns(const GFXfont *font, const FontColumns *columns);
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+
+  using Adafruit_GFX::drawBitmap;
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color);
+
+  using Adafruit_GFX::write;
+  size_t write(uint8_t c) override;
+
+private:
+  // maps a rectangle from the rotated coordinates drawing happens in to the
+  // buffer, and clips it to the clip rectangle. false if nothing is left.
+  bool toBuffer(int16_t *x, int16_t *y, int16_t *w, int16_t *h) const;
+  void fillSpan(int16_t x, int16_t y, int16_t w, bool white);
+  // copies the set bits of w source bits, starting offset bits into bits,
+  // to the buffer at (x, y) in the given color. unset bits are left alone.
+  void blitRow(int16_t x, int16_t y, const uint8_t *bits, uint32_t offset,
+               int16_t w, bool white);
+  void drawClassicChar(int16_t x, int16_t y, uint8_t c);
+  void drawGlyph(int16_t x, int16_t y, uint8_t c);
+  const FontColumns *fontColumns(const GFXfont *font) const;
+
+  static const uint8_t MAX_FONT_COLUMNS = 4;
+
+  uint8_t buffer_[ROW_BYTES * WatchyDisplay::HEIGHT];
+  uint32_t pixelsWritten_ = 0;
+  // the clip rectangle in buffer coordinates
+  bool clipped_  = false;
+  int16_t clipX_ = 0, clipY_ = 0;
+  int16_t clipW_ = WatchyDisplay::WIDTH, clipH_ = WatchyDisplay::HEIGHT;
+  const GFXfont *columnFonts_[MAX_FONT_COLUMNS] = {};
+  const FontColumns *columns_[MAX_FONT_COLUMNS] = {};
+};
+
+typedef Framebuffer DisplayBase;
+
+class Display : public DisplayBase {
+public:
+  // when enabled, the next fillScreen starts powering the panel on, so the
+  // power on time overlaps with rendering the rest of the frame.
+  void powerOnWhileDrawing(bool enabled) { powerOnWhileDrawing_ = enabled; }
+
+  // the next display() call does a full refresh, even if a partial one was
+  // asked for.
+  void scheduleFullRefresh() { fullRefreshScheduled_ = true; }
+  // picks the refresh profile for the next frame only.
+  void setRefreshProfile(RefreshProfile profile) {
+    epd2.refreshProfile = profile;
+  }
+  void display(bool partial_update_mode = false);
+  // whether display(partial_update_mode) will refresh the whole panel.
+  bool fullRefresh(bool partial_update_mode) const {
+    return !partial_update_mode || fullRefreshScheduled_ ||
+           epd2.refreshProfile == REFRESH_QUALITY;
+  }
+
+  // frames shown while enabled are drawn whole, never only where they
+  // changed, e.g. because a notice is going to be drawn over the buffer and
+  // sent. after a frame that was drawn only where it changed, the buffer is
+  // blank everywhere else.
+  void drawWholeFrames(bool enabled) { drawWholeFrames_ = enabled; }
+  bool drawsWholeFrames() const { return drawWholeFrames_; }
+
+  void fillScreen(uint16_t color) override;
+
+private:
+  bool powerOnWhileDrawing_  = false;
+  bool fullRefreshScheduled_ = false;
+  bool drawWholeFrames_      = false;
+};
@@ -0,0 +1,114 @@
+#include "Profiler.h"
+
+RTC_DATA_ATTR WakeProfile wakeProfiles[Profiler::WAKES];
+RTC_DATA_ATTR uint8_t wakeProfileNext;
+RTC_DATA_ATTR uint8_t wakeProfileCount;
+
+static WakeProfile current;
+static ProfilePhase currentPhase = PHASE_BOOT;
+static uint32_t phaseStart       = 0;
+
+static const char *phaseNames[PROFILE_PHASE_COUNT] = {
+    "boot",    "init", "panel", "button", "draw",  "spi",
+    "refresh", "wifi", "fetch", "ntp",    "sleep", "idle",
+};
+
+void Profiler::start() {
+  memset(&current, 0, sizeof(current));
+  // micros() counts from reset.
+  phaseStart                 = micros();
+  current.micros[PHASE_BOOT] = phaseStart;
+  currentPhase               = PHASE_INIT;
+}
+
+void Profiler::setReason(uint8_t reason) { current.reason = reason; }
+
+ProfilePhase Profiler::enter(ProfilePhase phase) {
+  ProfilePhase previous = currentPhase;
+  uint32_t now          = micros();
+  current.micros[currentPhase] += now - phaseStart;
+  phaseStart   = now;
+  currentPhase = phase;
+  return previous;
+}
+
+void Profiler::finish() {
+  enter(currentPhase);
+  wakeProfiles[wakeProfileNext] = current;
+  wakeProfileNext               = (wakeProfileNext + 1) % WAKES;
+  if (wakeProfileCount < WAKES) {
+    wakeProfileCount++;
+  }
+}
+
+const char *Profiler::name(ProfilePhase phase) { return phaseNames[phase]; }
+
+uint8_t Profiler::wakes() { return wakeProfileCount; }
+
+const WakeProfile &Profiler::wake(uint8_t i) {
+  return wakeProfiles[(wakeProfileNext + WAKES - 1 - i) % WAKES];
+}
+
+static uint32_t phaseMicros(const WakeProfile &wake, uint8_t phase) {
+  if (phase < PROFILE_PHASE_COUNT) {
+    return wake.micros[phase];
+  }
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < PROFILE_PHASE_COUNT; i++) {
+    total += wake.micros[i];
+  }
+  return total;
+}
+
+ProfileSummary Profiler::summary(uint8_t phase, uint8_t reason) {
+  uint32_t values[WAKES];
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < wakeProfileCount; i++) {
+    const WakeProfile &w = wake(i);
+    if (reason != 0xFF && w.reason != reason) {
+      continue;
+    }
+    // insertion sort, there are only a few.
+    uint32_t v = phaseMicros(w, phase);
+    uint8_t j  = n++;
+    for (; j > 0 && values[j - 1] > v; j--) {
+      values[j] = values[j - 1];
+    }
+    values[j] = v;
+  }
+
+  ProfileSummary summary = {n, 0, 0, 0};
+  if (n > 0) {
+    // nearest rank
+    summary.p50 = values[(50 * n + 99) / 100 - 1];
+    summary.p95 = values[(95 * n + 99) / 100 - 1];
+    summary.max = values[n - 1];
+  }
+  return summary;
+}
+
+void Profiler::dump(Print &out) {
+  out.print("reason");
+  for (uint8_t p = 0; p < PROFILE_PHASE_COUNT; p++) {
+    out.print('\t');
+    out.print(phaseNames[p]);
+  }
+  out.println("\ttotal");
+  for (uint8_t i = wakeProfileCount; i > 0; i--) {
+    const WakeProfile &w = wake(i - 1);
+    out.print(w.reason);
+    for (uint8_t p = 0; p <= PROFILE_PHASE_COUNT; p++) {
+      out.print('\t');
+      out.print(phaseMicros(w, p));
+    }
+    out.println();
+  }
+  out.println("phase\tp50\tp95\tmax");
+  for (uint8_t p = 0; p <= PROFILE_PHASE_COUNT; p++) {
+    ProfileSummary s = summary(p);
+    out.printf("%s\t%lu\t%lu\t%lu\n",
+               p < PROFILE_PHASE_COUNT ? phaseNames[p] : "total",
+               (unsigned long)s.p50, (unsigned long)s.p95,
+               (unsigned long)s.max);
+  }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Arduino.h>
+
+// where a wake spends its time. time is charged to one phase at a time, so
+// a phase nested in another (the refresh wait inside a frame write inside
+// show) isn't counted twice.
+typedef enum ProfilePhase {
+  PHASE_BOOT    = 0,  // reset until wakeup() starts
+  PHASE_INIT    = 1,  // i2c, rtc and sensor setup
+  PHASE_PANEL   = 2,  // bringing up the panel controller
+  PHASE_BUTTON  = 3,  // button dispatch
+  PHASE_DRAW    = 4,  // app->show, apart from what's below
+  PHASE_SPI     = 5,  // frame writes to the controller
+  PHASE_REFRESH = 6,  // waiting for the panel to refresh
+  PHASE_WIFI    = 7,  // connectWiFi
+  PHASE_FETCH   = 8,  // fetchNetwork
+  PHASE_NTP     = 9,  // syncNTP
+  PHASE_SLEEP   = 10, // sleep() until deep sleep starts
+  PHASE_IDLE    = 11, // light sleep waiting for a button
+} ProfilePhase;
+
+#define PROFILE_PHASE_COUNT 12
+
+typedef struct WakeProfile {
+  uint8_t reason; // WakeupReason
+  uint32_t micros[PROFILE_PHASE_COUNT];
+} WakeProfile;
+
+typedef struct ProfileSummary {
+  uint8_t samples;
+  uint32_t p50, p95, max; // microseconds
+} ProfileSummary;
+
+class Profiler {
+public:
+  // the last wakes are kept in RTC memory.
+  static const uint8_t WAKES = 8;
+
+  // starts timing a wake. time since reset goes to PHASE_BOOT.
+  static void start();
+  // the WakeupReason, once it is known.
+  static void setReason(uint8_t reason);
+  // charges the time from here on to phase, returning the previous phase.
+  static ProfilePhase enter(ProfilePhase phase);
+  // stores the wake in the ring. called right before deep sleep.
+  static void finish();
+
+  static const char *name(ProfilePhase phase);
+
+  // over the stored wakes. a phase of PROFILE_PHASE_COUNT means the whole
+  // wake, and a reason of 0xFF means wakes of any reason.
+  static ProfileSummary summary(uint8_t phase, uint8_t reason = 0xFF);
+  static uint8_t wakes();
+  static const WakeProfile &wake(uint8_t i); // 0 is the latest
+
+  // every stored wake as a line of tab separated microseconds, then the
+  // summaries.
+  static void dump(Print &out);
+};
+
+// charges the time while in scope to phase.
+class ProfileScope {
+public:
+  explicit ProfileScope(ProfilePhase phase)
+      : previous_(Profiler::enter(phase)) {}
+  ~ProfileScope() { Profiler::enter(previous_); }
+
+private:
+  ProfilePhase previous_;
+};
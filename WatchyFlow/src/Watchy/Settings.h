@@ -10,6 +10,17 @@ typedef enum ButtonConfiguration {
   BUTTONS_SELECT_BACK_RIGHT = 1,
 } ButtonConfiguration;
 
+// modeled current draw for the energy accounting in the About app. fields
+// left zeroed use typical Watchy figures.
+typedef struct EnergyModel {
+  uint32_t cpuMicroAmps;     // awake with the radios off
+  uint32_t busyMicroAmps;    // light sleep, waiting for the panel or a button
+  uint32_t wifiMicroAmps;    // awake with WiFi on
+  uint32_t displayMicroAmps; // the panel booster, on top of busy
+  uint32_t deepSleepMicroAmps;
+  uint16_t batteryMah;
+} EnergyModel;
+
 typedef struct WatchySettings {
   // number of seconds between network fetch attempts
   int networkFetchIntervalSeconds;
@@ -26,4 +37,16 @@ typedef struct WatchySettings {
 
   float fullVoltage;
   float emptyVoltage;
+
+  // local hours during which apps wake hourly instead of every minute, and
+  // calendar events don't buzz. start is inclusive, end exclusive. both zero
+  // means 22 to 6, equal otherwise means never.
+  uint8_t quietHoursStart;
+  uint8_t quietHoursEnd;
+
+  // after a button wakes the watch, it stays in light sleep this long for the
+  // next press instead of going back to deep sleep. 0 disables this.
+  uint32_t interactiveTimeoutMillis;
+
+  EnergyModel energy;
 } WatchySettings;
@@ -0,0 +1,88 @@
+#include "WakeStub.h"
+
+#ifdef ARDUINO_ESP32S3_DEV
+#include "esp_sleep.h"
+#include "soc/rtc.h"
+#include "soc/rtc_cntl_reg.h"
+#include "rom/rtc.h"
+#endif
+
+// only the stub calls it, and V2 can't run code from RTC memory on the app
+// core.
+#ifdef ARDUINO_ESP32S3_DEV
+#define WAKE_STUB_ATTR RTC_IRAM_ATTR
+#else
+#define WAKE_STUB_ATTR
+#endif
+
+RTC_DATA_ATTR WakeStubState wakeStub;
+
+WAKE_STUB_ATTR bool wakeStubMustBoot(bool timer, uint64_t now,
+                                     uint64_t deadline) {
+  if (!timer || deadline == 0) {
+    return true;
+  }
+  // ticks left until the deadline, also when the counter wrapped around in
+  // between. a deadline that already passed comes out negative.
+  const uint8_t unused = 64 - WAKE_STUB_TIMER_BITS;
+  int64_t left         = int64_t((deadline - now) << unused) >> unused;
+  return left <= WAKE_STUB_SLACK_TICKS;
+}
+
+WAKE_STUB_ATTR bool wakeStubWake(bool timer, uint64_t now) {
+  if (wakeStubMustBoot(timer, now, wakeStub.deadline)) {
+    wakeStub.deadline = 0;
+    return true;
+  }
+  wakeStub.skipped++;
+  return false;
+}
+
+uint32_t WakeStub::skipped() { return wakeStub.skipped; }
+
+void WakeStub::reset() { memset(&wakeStub, 0, sizeof(wakeStub)); }
+
+#ifdef ARDUINO_ESP32S3_DEV
+
+void WakeStub::arm(uint64_t micros) {
+  // the slow clock period in microseconds, as fixed point.
+  uint32_t period = REG_READ(RTC_SLOW_CLK_CAL_REG);
+  uint64_t ticks  = (micros << RTC_CLK_CAL_FRACT) / period;
+  wakeStub.deadline =
+      (rtc_time_get() + ticks) & ((1ULL << WAKE_STUB_TIMER_BITS) - 1);
+  if (wakeStub.deadline == 0) {
+    // 0 means not armed
+    wakeStub.deadline = 1;
+  }
+}
+
+// runs before flash and most of RAM are set up, so everything it touches has
+// to live in RTC memory, and it can only use registers and the ROM.
+extern "C" void RTC_IRAM_ATTR esp_wake_deep_sleep(void) {
+  SET_PERI_REG_MASK(RTC_CNTL_TIME_UPDATE_REG, RTC_CNTL_TIME_UPDATE);
+  uint64_t now = READ_PERI_REG(RTC_CNTL_TIME_LOW0_REG) |
+                 (uint64_t(READ_PERI_REG(RTC_CNTL_TIME_HIGH0_REG)) << 32);
+  uint32_t cause =
+      REG_GET_FIELD(RTC_CNTL_SLP_WAKEUP_CAUSE_REG, RTC_CNTL_WAKEUP_CAUSE);
+  if (wakeStubWake(cause == RTC_TIMER_TRIG_EN, now)) {
+    esp_default_wake_deep_sleep();
+    return;
+  }
+
+  // the other wakeup sources are still configured from sleep().
+  WRITE_PERI_REG(RTC_CNTL_SLP_TIMER0_REG, uint32_t(wakeStub.deadline));
+  WRITE_PERI_REG(RTC_CNTL_SLP_TIMER1_REG, uint32_t(wakeStub.deadline >> 32));
+  SET_PERI_REG_MASK(RTC_CNTL_INT_CLR_REG, RTC_CNTL_MAIN_TIMER_INT_CLR_M);
+  SET_PERI_REG_MASK(RTC_CNTL_SLP_TIMER1_REG, RTC_CNTL_MAIN_TIMER_ALARM_EN_M);
+  REG_WRITE(RTC_ENTRY_ADDR_REG, (uintptr_t)&esp_wake_deep_sleep);
+  CLEAR_PERI_REG_MASK(RTC_CNTL_STATE0_REG, RTC_CNTL_SLEEP_EN);
+  SET_PERI_REG_MASK(RTC_CNTL_STATE0_REG, RTC_CNTL_SLEEP_EN);
+  while (true) {
+  }
+}
+
+#else
+
+void WakeStub::arm(uint64_t micros) {}
+
+#endif
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <Arduino.h>
+
+// on V3, clock wakeups first run a small stub from RTC memory. if the timer
+// fired before the wakeup sleep() asked for, it arms the timer again and goes
+// straight back to deep sleep, skipping the boot, setup() and the display.
+// anything else, like a button or USB, boots as usual.
+//
+// V2 clock wakeups come from the external RTC, which the stub can't reach, so
+// there the alarm set in sleep() is all there is.
+typedef struct WakeStubState {
+  uint64_t deadline; // in RTC slow clock ticks, 0 if not armed
+  uint32_t skipped;  // boots skipped since reset
+} WakeStubState;
+
+extern WakeStubState wakeStub;
+
+// the RTC timer counts slow clock ticks in 48 bits, and wraps around.
+#define WAKE_STUB_TIMER_BITS 48
+// close enough to the deadline to boot anyway, about a millisecond of the
+// slow clock.
+#define WAKE_STUB_SLACK_TICKS 150
+
+// whether a wakeup at now has to boot. timer says the sleep timer, and
+// nothing else, woke the chip.
+bool wakeStubMustBoot(bool timer, uint64_t now, uint64_t deadline);
+// decides a wakeup at now against wakeStub. the deadline is cleared when it
+// boots, and the skip counted when it doesn't.
+bool wakeStubWake(bool timer, uint64_t now);
+
+class WakeStub {
+public:
+  // the wakeup is due micros from now. called right before deep sleep.
+  static void arm(uint64_t micros);
+  static uint32_t skipped();
+  static void reset();
+};
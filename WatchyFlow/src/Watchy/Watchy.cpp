@@ -11,6 +11,8 @@
 #include "bma.h"
 #include "config.h"
 #include "esp_chip_info.h"
+#include "esp_sleep.h"
+#include "driver/gpio.h"
 #ifdef ARDUINO_ESP32S3_DEV
 #include "Watchy32KRTC.h"
 #include "soc/rtc.h"
@@ -33,6 +35,11 @@
 #endif
 
 #include "../Layout/Layout.h"
+#include "../Elements/Notice.h"
+#include "ButtonQueue.h"
+#include "Energy.h"
+#include "Profiler.h"
+#include "WakeStub.h"
 #include "WatchyApp.h"
 
 #ifdef ARDUINO_ESP32S3_DEV
@@ -43,7 +50,7 @@ WatchyRTC rtc_;
 #define ACTIVE_LOW 1
 #endif
 
-GxEPD2_BW<WatchyDisplay, WatchyDisplay::HEIGHT> display_(WatchyDisplay{});
+Display display_;
 
 RTC_DATA_ATTR BMA423 sensor_;
 RTC_DATA_ATTR bool usbPluggedIn_;
@@ -52,12 +59,265 @@ RTC_DATA_ATTR time_t lastSuccessfulNetworkFetch_;
 RTC_DATA_ATTR uint8_t fetchTries_;
 RTC_DATA_ATTR time_t timezoneOffset_;
 RTC_DATA_ATTR int lastSuccessfulWiFiIndex_;
+// from the last button press to its frame being sent, when it woke the watch
+// and when it came during an interactive session.
+RTC_DATA_ATTR uint32_t buttonLatency_[2];
+
+// how the last network was joined through DHCP, to join it again quickly.
+typedef struct WiFiCache {
+  time_t joined; // 0 if nothing is cached
+  int index;     // into settings.wifiNetworks
+  uint8_t bssid[6];
+  int32_t channel;
+  uint32_t ip, gateway, subnet, dns;
+} WiFiCache;
+
+RTC_DATA_ATTR WiFiCache wifiCache_;
+RTC_DATA_ATTR WiFiStats wifiStats_;
+
+// local time the next clock wakeup is due, picked by scheduleWakeup.
+static time_t wakeAt_;
+
+// partial refreshes slowly leave ghosting behind. full refreshes clear it, but
+// they take seconds and flash the panel, so they are held back until nobody
+// is likely to be looking or power is cheap.
+#define FULL_REFRESH_NIGHT_START  2 // hour of the night window, inclusive
+#define FULL_REFRESH_NIGHT_END    5 // exclusive
+#define FULL_REFRESH_NIGHT_PIXELS 40000
+#define FULL_REFRESH_USB_PIXELS   10000
+#define FULL_REFRESH_MAX_PARTIALS 1440
+
+static bool fullRefreshDue(const tmElements_t &local, WakeupReason reason) {
+  const DisplayStats &stats = WatchyDisplay::stats();
+  if (stats.partialsSinceFull == 0) {
+    return false;
+  }
+  if (stats.partialsSinceFull >= FULL_REFRESH_MAX_PARTIALS) {
+    return true;
+  }
+  if (reason == WAKEUP_USB ||
+      (usbPluggedIn_ && reason == WAKEUP_CLOCK &&
+       stats.pixelsSinceFull >= FULL_REFRESH_USB_PIXELS)) {
+    return true;
+  }
+  return reason == WAKEUP_CLOCK && local.Hour >= FULL_REFRESH_NIGHT_START &&
+         local.Hour < FULL_REFRESH_NIGHT_END &&
+         stats.pixelsSinceFull >= FULL_REFRESH_NIGHT_PIXELS;
+}
+
+#define QUIET_HOURS_START 22
+#define QUIET_HOURS_END   6
+// the watch wakes at least this often, whatever the app asks for.
+#define MAX_SLEEP_SECONDS (60 * 60)
+
+static void scheduleWakeup(WatchyApp *app, Watchy &watchy,
+                           const WatchySettings &settings) {
+  time_t now  = watchy.unixtime();
+  time_t next = app->nextWakeup(&watchy);
+  // fetches are retried every wake until the tries run out.
+  time_t fetch = watchy.nextMinute();
+  if (fetchTries_ >= settings.networkFetchTries) {
+    fetch = lastFetchAttempt_ + settings.networkFetchIntervalSeconds + 1;
+  }
+  if (fetch < next) {
+    next = fetch;
+  }
+  if (next > now + MAX_SLEEP_SECONDS) {
+    next = now + MAX_SLEEP_SECONDS;
+  }
+  wakeAt_ = next + timezoneOffset_;
+}
+
+// the level of a pressed button
+#define BUTTON_PRESSED ACTIVE_LOW
+#ifdef ARDUINO_ESP32S3_DEV
+// V3 buttons pull low, and UP has no pull-up on the board. sleep() enables the
+// RTC one for deep sleep, this keeps it while awake.
+#define BUTTON_PIN_MODE INPUT_PULLUP
+#else
+#define BUTTON_PIN_MODE INPUT
+#endif
+#define BUTTON_POLL_MS 10
+
+static const uint8_t buttonPins[] = {MENU_BTN_PIN, BACK_BTN_PIN, UP_BTN_PIN,
+                                     DOWN_BTN_PIN};
+static const uint64_t buttonMasks[] = {MENU_BTN_MASK, BACK_BTN_MASK,
+                                       UP_BTN_MASK, DOWN_BTN_MASK};
+
+// bit i set while buttonPins[i] is down
+static uint8_t heldButtons() {
+  uint8_t held = 0;
+  for (uint8_t i = 0; i < sizeof(buttonPins); i++) {
+    if (digitalRead(buttonPins[i]) == BUTTON_PRESSED) {
+      held |= 1 << i;
+    }
+  }
+  return held;
+}
+
+// presses during an interactive session, including those that came while
+// the panel was refreshing.
+static ButtonQueue buttonQueue;
+
+static void sampleButtons() { buttonQueue.sample(heldButtons(), millis()); }
+
+// buttons has the *_BTN_MASK bits of the pressed buttons. only one is handled.
+static void pressButton(WatchyApp *app, Watchy *watchy,
+                        ButtonConfiguration config, uint64_t buttons) {
+  if (buttons & MENU_BTN_MASK) {
+    if (config == BUTTONS_SELECT_BACK_RIGHT) {
+      app->buttonDown(watchy);
+    } else {
+      app->buttonSelect(watchy);
+    }
+  } else if (buttons & BACK_BTN_MASK) {
+    if (config == BUTTONS_SELECT_BACK_RIGHT) {
+      app->buttonUp(watchy);
+    } else {
+      app->buttonBack(watchy);
+    }
+  } else if (buttons & UP_BTN_MASK) {
+    if (config == BUTTONS_SELECT_BACK_RIGHT) {
+      app->buttonBack(watchy);
+    } else {
+      app->buttonUp(watchy);
+    }
+  } else if (buttons & DOWN_BTN_MASK) {
+    if (config == BUTTONS_SELECT_BACK_RIGHT) {
+      app->buttonSelect(watchy);
+    } else {
+      app->buttonDown(watchy);
+    }
+  }
+}
+
+void Watchy::interact(WatchyApp *app, Watchy *watchy,
+                      const WatchySettings &settings) {
+  for (uint8_t i = 0; i < sizeof(buttonPins); i++) {
+    pinMode(buttonPins[i], BUTTON_PIN_MODE);
+    gpio_wakeup_enable((gpio_num_t)buttonPins[i],
+                       BUTTON_PRESSED ? GPIO_INTR_HIGH_LEVEL
+                                      : GPIO_INTR_LOW_LEVEL);
+  }
+
+  // the press that woke the watch was handled already.
+  buttonQueue.start(heldButtons(), millis());
+  WatchyDisplay::whileBusy = sampleButtons;
+
+  uint32_t lastPress = millis();
+  while (true) {
+    sampleButtons();
+    if (!buttonQueue.empty()) {
+      uint32_t pressStart = micros();
+      tmElements_t currentTime;
+      rtc_.read(currentTime);
+      watchy->reset(currentTime, WAKEUP_BUTTON);
+      {
+        ProfileScope phase(PHASE_BUTTON);
+        uint8_t button, count;
+        while (buttonQueue.pop(&button, &count)) {
+          // repeats change the state as many times, but are drawn once.
+          for (uint8_t i = 0; i < count; i++) {
+            pressButton(app, watchy, settings.buttonConfig,
+                        buttonMasks[button]);
+          }
+        }
+      }
+      {
+        ProfileScope phase(PHASE_DRAW);
+        app->show(watchy, &display_, true);
+      }
+      buttonLatency_[1] = micros() - pressStart;
+      lastPress         = millis();
+      continue;
+    }
+
+    uint32_t idle = millis() - lastPress;
+    if (idle >= settings.interactiveTimeoutMillis) {
+      break;
+    }
+    if (heldButtons() != 0) {
+      // wakeups are level triggered, so a held button would wake right away.
+      delay(BUTTON_POLL_MS);
+      continue;
+    }
+
+    uint64_t sleepMicros =
+        uint64_t(settings.interactiveTimeoutMillis - idle) * 1000;
+    time_t tick = app->nextWakeup(watchy);
+    if (tick <= watchy->unixtime()) {
+      sleepMicros = 0;
+    } else if (uint64_t(tick - watchy->unixtime()) * 1000000 < sleepMicros) {
+      // close enough, the clock only has seconds anyway.
+      sleepMicros = uint64_t(tick - watchy->unixtime()) * 1000000;
+    }
+    // the panel's busy wait leaves its own pin armed.
+    gpio_wakeup_disable((gpio_num_t)DISPLAY_BUSY);
+    esp_sleep_enable_gpio_wakeup();
+    esp_sleep_enable_timer_wakeup(sleepMicros);
+    {
+      ProfileScope phase(PHASE_IDLE);
+      esp_light_sleep_start();
+    }
+    if (esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_TIMER) {
+      continue;
+    }
+
+    tmElements_t currentTime;
+    rtc_.read(currentTime);
+    watchy->reset(currentTime, WAKEUP_CLOCK);
+    if (watchy->unixtime() >= tick) {
+      ProfileScope phase(PHASE_DRAW);
+      app->show(watchy, &display_, true);
+    }
+  }
+
+  WatchyDisplay::whileBusy = nullptr;
+  for (uint8_t i = 0; i < sizeof(buttonPins); i++) {
+    gpio_wakeup_disable((gpio_num_t)buttonPins[i]);
+  }
+  // the timer would otherwise stay armed into deep sleep.
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+}
+
+// whether a network fetch is due, counting it as a try if so.
+static bool fetchDue(time_t now, const WatchySettings &settings) {
+  time_t staleTime = now - settings.networkFetchIntervalSeconds;
+
+  if (fetchTries_ >= settings.networkFetchTries) {
+    // if lastFetchAttempt is in the future, perhaps the timezone
+    // just changed, so we don't want to count that.
+    if (lastFetchAttempt_ >= staleTime && lastFetchAttempt_ < now) {
+      // lastFetchAttempt is newer than staleTime but not in the future.
+      // nothing to do.
+      return false;
+    }
+    // okay it's been long enough that we should start over on our try counter.
+    fetchTries_ = 0;
+  }
+
+  lastFetchAttempt_ = now;
+  fetchTries_++;
+  return true;
+}
 
 void _sensorSetup();
 
 void Watchy::sleep() {
+  Profiler::enter(PHASE_SLEEP);
   display_.hibernate();
   rtc_.clearAlarm(); // resets the alarm flag in the RTC
+
+  tmElements_t local;
+  rtc_.read(local);
+  time_t now = makeTime(local);
+  // alarms only match whole minutes, and one that already passed would never
+  // fire.
+  time_t wakeAt = (wakeAt_ + 59) / 60 * 60;
+  if (wakeAt <= now) {
+    wakeAt = now - local.Second + 60;
+  }
 #ifdef ARDUINO_ESP32S3_DEV
   esp_sleep_enable_ext0_wakeup(
       (gpio_num_t)USB_DET_PIN,
@@ -74,11 +334,13 @@ void Watchy::sleep() {
 
   rtc_clk_32k_enable(true);
   // rtc_clk_slow_freq_set(RTC_SLOW_FREQ_32K_XTAL);
-  struct tm timeinfo;
-  getLocalTime(&timeinfo);
-  int secToNextMin = 60 - timeinfo.tm_sec;
-  esp_sleep_enable_timer_wakeup(secToNextMin * uS_TO_S_FACTOR);
+  WakeStub::arm((wakeAt - now) * uS_TO_S_FACTOR);
+  esp_sleep_enable_timer_wakeup((wakeAt - now) * uS_TO_S_FACTOR);
 #else
+  tmElements_t alarm;
+  breakTime(wakeAt, alarm);
+  rtc_.setAlarm(alarm);
+
   // Set GPIOs 0-39 to input to avoid power leaking out
   const uint64_t ignore =
       0b11110001000000110000100111000010; // Ignore some GPIOs due to resets
@@ -93,19 +355,103 @@ void Watchy::sleep() {
       BTN_PIN_MASK,
       ESP_EXT1_WAKEUP_ANY_HIGH); // enable deep sleep wake on button press
 #endif
+  Profiler::finish();
+  Energy::finish(Profiler::wake(0));
   esp_deep_sleep_start();
 }
 
-bool connectWiFi(WatchySettings settings) {
+#define WIFI_FAST_TIMEOUT_MS 3000
+// DHCP leases usually last a day. the cached one is only reused well within
+// that, since it isn't renewed.
+#define WIFI_CACHE_SECONDS (12 * 60 * 60)
+
+// the join in progress, and whether a static lease is configured.
+static uint32_t joinStart_;
+static bool joinFast_;
+static bool staticIP_;
+
+static bool joinCached(int idx, time_t now) {
+  return wifiCache_.joined != 0 && wifiCache_.index == idx &&
+         now >= wifiCache_.joined &&
+         now - wifiCache_.joined < WIFI_CACHE_SECONDS;
+}
+
+// starts joining network idx without waiting. if it was joined through DHCP
+// recently, that's straight to the same access point on its channel, with
+// the same lease.
+static wl_status_t beginJoin(const WatchySettings &settings, int idx,
+                             time_t now) {
+  const WiFiConfig &network = settings.wifiNetworks[idx];
+  joinStart_                = millis();
+  joinFast_                 = joinCached(idx, now);
+  if (joinFast_) {
+    wifiStats_.fastJoins++;
+    staticIP_ = true;
+    WiFi.config(IPAddress(wifiCache_.ip), IPAddress(wifiCache_.gateway),
+                IPAddress(wifiCache_.subnet), IPAddress(wifiCache_.dns));
+    return WiFi.begin(network.SSID.c_str(), network.Pass.c_str(),
+                      wifiCache_.channel, wifiCache_.bssid);
+  }
+  if (staticIP_) {
+    // back to DHCP
+    staticIP_ = false;
+    WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+  }
+  return WiFi.begin(network.SSID.c_str(), network.Pass.c_str());
+}
+
+// waits for the join beginJoin started.
+static bool finishJoin(const WatchySettings &settings, int idx, time_t now) {
+  if (joinFast_) {
+    if (WL_CONNECTED == WiFi.waitForConnectResult(WIFI_FAST_TIMEOUT_MS)) {
+      wifiStats_.fastMillis = millis() - joinStart_;
+      return true;
+    }
+    // the access point, its channel or the lease changed. scan and ask DHCP.
+    wifiStats_.fastFails++;
+    wifiCache_.joined = 0;
+    WiFi.disconnect();
+    if (WL_CONNECT_FAILED == beginJoin(settings, idx, now)) {
+      return false;
+    }
+  }
+  if (WL_CONNECTED != WiFi.waitForConnectResult()) {
+    return false;
+  }
+  wifiStats_.slowMillis = millis() - joinStart_;
+
+  // only a lease from DHCP is cached, so it can't outlive the original.
+  wifiCache_.joined = now;
+  wifiCache_.index  = idx;
+  memcpy(wifiCache_.bssid, WiFi.BSSID(), sizeof(wifiCache_.bssid));
+  wifiCache_.channel = WiFi.channel();
+  wifiCache_.ip      = WiFi.localIP();
+  wifiCache_.gateway = WiFi.gatewayIP();
+  wifiCache_.subnet  = WiFi.subnetMask();
+  wifiCache_.dns     = WiFi.dnsIP();
+  return true;
+}
+
+// starts associating with the network that worked last, without waiting.
+// connectWiFi picks it up from there.
+void beginWiFi(const WatchySettings &settings, time_t now) {
+  if (settings.wifiNetworkCount == 0) {
+    return;
+  }
+  beginJoin(settings, lastSuccessfulWiFiIndex_ % settings.wifiNetworkCount,
+            now);
+}
+
+bool connectWiFi(WatchySettings settings, bool begun, time_t now) {
   for (int i = 0; i < settings.wifiNetworkCount; i++) {
     int idxToUse = (i + lastSuccessfulWiFiIndex_) % settings.wifiNetworkCount;
 
-    if (WL_CONNECT_FAILED == WiFi.begin(settings.wifiNetworks[idxToUse].SSID,
-                                        settings.wifiNetworks[idxToUse].Pass)) {
+    if ((i > 0 || !begun) &&
+        WL_CONNECT_FAILED == beginJoin(settings, idxToUse, now)) {
       continue;
     }
 
-    if (WL_CONNECTED != WiFi.waitForConnectResult()) {
+    if (!finishJoin(settings, idxToUse, now)) {
       WiFi.mode(WIFI_OFF);
       btStop();
       continue;
@@ -118,6 +464,7 @@ bool connectWiFi(WatchySettings settings) {
 }
 
 void Watchy::wakeup(WatchyApp *app, WatchySettings settings) {
+  Profiler::start();
   esp_sleep_wakeup_cause_t wakeup_reason;
   wakeup_reason = esp_sleep_get_wakeup_cause(); // get wake up reason
 #ifdef ARDUINO_ESP32S3_DEV
@@ -126,10 +473,11 @@ void Watchy::wakeup(WatchyApp *app, WatchySettings settings) {
   Wire.begin(SDA, SCL); // init i2c
 #endif
   rtc_.init();
-  display_.epd2.initWatchy();
+  // the panel controller is brought up lazily by the first write that needs it
+  // and refreshes run in the background. the next controller command, or
+  // hibernate in sleep(), waits for them.
+  display_.epd2.asyncRefresh = true;
   display_.cp437(true);
-  display_.setFullWindow();
-  display_.epd2.asyncPowerOn();
 
   WakeupReason wakeup_reason_enum = WAKEUP_RESET;
 
@@ -168,13 +516,45 @@ void Watchy::wakeup(WatchyApp *app, WatchySettings settings) {
     fetchTries_                 = 0;
     timezoneOffset_             = settings.defaultTimezoneOffset;
     lastSuccessfulWiFiIndex_    = 0;
+    Energy::reset();
+    WakeStub::reset();
+    memset(&wifiCache_, 0, sizeof(wifiCache_));
+    memset(&wifiStats_, 0, sizeof(wifiStats_));
     break;
   }
+  Profiler::setReason(wakeup_reason_enum);
+
+  // clock ticks often redraw the frame the panel already shows, and those
+  // should never wake the controller or power the booster. they do that only
+  // once a changed frame is written, everything else overlaps power on with
+  // rendering.
+  display_.powerOnWhileDrawing(wakeup_reason_enum != WAKEUP_CLOCK);
 
   tmElements_t currentTime;
   rtc_.read(currentTime);
   Watchy watchy(currentTime, wakeup_reason_enum, settings);
+  Energy::begin(settings.energy, watchy.unixtime(),
+                makeTime(currentTime) / SECS_PER_DAY);
+
+  // whether to fetch is mostly known now, so the radio can associate while the
+  // first frame is drawn and refreshed. not before an interactive session
+  // though, that would keep it on for the whole session.
+  bool interactive = wakeup_reason_enum == WAKEUP_BUTTON &&
+                     settings.interactiveTimeoutMillis > 0;
+  bool wifiBegun   = !interactive && fetchDue(watchy.unixtime(), settings);
+  // notices are drawn over the last frame before a fetch, so that frame has
+  // to be whole in the buffer. a session may ask for a fetch too.
+  bool notices = showsNotices(wakeup_reason_enum);
+  display_.drawWholeFrames(notices && (wifiBegun || interactive));
+  if (wifiBegun) {
+    ProfileScope phase(PHASE_WIFI);
+    WatchyDisplay::sleepWhileBusy = false;
+    beginWiFi(settings, watchy.unixtime());
+  }
   bool partialRefresh = true;
+  if (fullRefreshDue(watchy.localtime(), wakeup_reason_enum)) {
+    display_.scheduleFullRefresh();
+  }
 
   switch (wakeup_reason) {
 #ifdef ARDUINO_ESP32S3_DEV
@@ -185,32 +565,9 @@ void Watchy::wakeup(WatchyApp *app, WatchySettings settings) {
     break;
   case ESP_SLEEP_WAKEUP_EXT1: // button Press
   {
-    uint64_t wakeupBit = esp_sleep_get_ext1_wakeup_status();
-    if (wakeupBit & MENU_BTN_MASK) {
-      if (settings.buttonConfig == BUTTONS_SELECT_BACK_RIGHT) {
-        app->buttonDown(&watchy);
-      } else {
-        app->buttonSelect(&watchy);
-      }
-    } else if (wakeupBit & BACK_BTN_MASK) {
-      if (settings.buttonConfig == BUTTONS_SELECT_BACK_RIGHT) {
-        app->buttonUp(&watchy);
-      } else {
-        app->buttonBack(&watchy);
-      }
-    } else if (wakeupBit & UP_BTN_MASK) {
-      if (settings.buttonConfig == BUTTONS_SELECT_BACK_RIGHT) {
-        app->buttonBack(&watchy);
-      } else {
-        app->buttonUp(&watchy);
-      }
-    } else if (wakeupBit & DOWN_BTN_MASK) {
-      if (settings.buttonConfig == BUTTONS_SELECT_BACK_RIGHT) {
-        app->buttonSelect(&watchy);
-      } else {
-        app->buttonDown(&watchy);
-      }
-    }
+    ProfileScope phase(PHASE_BUTTON);
+    pressButton(app, &watchy, settings.buttonConfig,
+                esp_sleep_get_ext1_wakeup_status());
   } break;
 #ifdef ARDUINO_ESP32S3_DEV
   case ESP_SLEEP_WAKEUP_EXT0: // USB plug in
@@ -222,38 +579,47 @@ void Watchy::wakeup(WatchyApp *app, WatchySettings settings) {
     break;
   }
 
-  app->show(&watchy, &display_, partialRefresh);
-
-  time_t now       = watchy.unixtime();
-  time_t staleTime = now - settings.networkFetchIntervalSeconds;
-
-  if (fetchTries_ >= settings.networkFetchTries) {
-    // if lastFetchAttempt is in the future, perhaps the timezone
-    // just changed, so we don't want to count that.
-    if (lastFetchAttempt_ >= staleTime && lastFetchAttempt_ < now) {
-      // lastFetchAttempt is newer than staleTime but not in the future.
-      // nothing to do.
-      return;
+  {
+    ProfileScope phase(PHASE_DRAW);
+    app->show(&watchy, &display_, partialRefresh);
+  }
+  if (wakeup_reason_enum == WAKEUP_BUTTON) {
+    // micros() starts a little after the press, with the boot.
+    buttonLatency_[0] = micros();
+    if (interactive) {
+      interact(app, &watchy, settings);
     }
-    // okay it's been long enough that we should start over on our try counter.
-    fetchTries_ = 0;
   }
+  Energy::setApp(app->name());
 
-  lastFetchAttempt_ = now;
-  fetchTries_++;
+  // a button may have asked for a fetch since.
+  bool fetch = wifiBegun || fetchDue(watchy.unixtime(), settings);
+  if (!fetch) {
+    scheduleWakeup(app, watchy, settings);
+    return;
+  }
 
-  drawNotice("Connecting...");
+  WatchyDisplay::sleepWhileBusy = false;
+  if (notices && (!wifiBegun || WiFi.status() != WL_CONNECTED)) {
+    drawNotice("Connecting...");
+  }
 
-  if (connectWiFi(settings)) {
-    drawNotice("Loading...   ");
+  Profiler::enter(PHASE_WIFI);
+  if (connectWiFi(settings, wifiBegun, watchy.unixtime())) {
+    if (notices) {
+      drawNotice("Loading...   ");
+    }
 
+    Profiler::enter(PHASE_FETCH);
     FetchState fetchResult = app->fetchNetwork(&watchy);
-    if (syncNTP()) {
+    Profiler::enter(PHASE_NTP);
+    bool synced = syncNTP();
+    Profiler::enter(PHASE_INIT);
+    if (synced) {
       rtc_.read(currentTime);
       watchy.reset(currentTime, WAKEUP_NETFETCH);
-      now = watchy.unixtime();
       if (fetchResult == FETCH_OK) {
-        lastSuccessfulNetworkFetch_ = now;
+        lastSuccessfulNetworkFetch_ = watchy.unixtime();
         fetchTries_                 = settings.networkFetchTries;
       }
     }
@@ -261,8 +627,11 @@ void Watchy::wakeup(WatchyApp *app, WatchySettings settings) {
     WiFi.mode(WIFI_OFF);
     btStop();
   }
-
+  WatchyDisplay::sleepWhileBusy = true;
+  Profiler::enter(PHASE_DRAW);
   app->show(&watchy, &display_, true);
+  Profiler::enter(PHASE_INIT);
+  scheduleWakeup(app, watchy, settings);
 }
 
 void Watchy::reset(const tmElements_t &currentTime, WakeupReason wakeup) {
@@ -357,18 +726,31 @@ time_t Watchy::lastSuccessfulNetworkFetch() {
 }
 
 void Watchy::drawNotice(char *msg) {
-  LayoutBackground notice(
-      LayoutBorder(LayoutPad(LayoutText(msg, NULL, GxEPD_BLACK), 3, 3, 3, 3),
-                   true, true, true, true, GxEPD_BLACK),
-      GxEPD_WHITE);
-
-  uint16_t w, h;
-  notice.size(&display_, 0, 0, &w, &h);
-  notice.draw(&display_, display_.width() - w - 3, display_.height() - h - 3, 0,
-              0, &w, &h);
-  display_.display(true);
+  ProfileScope phase(PHASE_DRAW);
+  showNotice(&display_, msg);
 }
 
+bool Watchy::quietHours() {
+  uint8_t start = settings_.quietHoursStart;
+  uint8_t end   = settings_.quietHoursEnd;
+  if (start == 0 && end == 0) {
+    start = QUIET_HOURS_START;
+    end   = QUIET_HOURS_END;
+  }
+  if (start <= end) {
+    return localtime_.Hour >= start && localtime_.Hour < end;
+  }
+  return localtime_.Hour >= start || localtime_.Hour < end;
+}
+
+uint32_t Watchy::buttonLatencyMicros(bool interactive) {
+  return buttonLatency_[interactive ? 1 : 0];
+}
+
+const WiFiStats &Watchy::wifiStats() { return wifiStats_; }
+
+bool Watchy::usbPluggedIn() { return usbPluggedIn_; }
+
 uint32_t Watchy::stepCounter() { return sensor_.getCounter(); }
 
 void Watchy::resetStepCounter() { sensor_.resetStepCounter(); }
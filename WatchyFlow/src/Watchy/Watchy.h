@@ -1,8 +1,8 @@
 #pragma once
 
 #include <TimeLib.h>
-#include <GxEPD2_BW.h>
 #include "Display.h"
+#include "Framebuffer.h"
 
 #ifdef ARDUINO_ESP32S3_DEV
 #define IS_WATCHY_V3
@@ -14,14 +14,19 @@
 
 class WatchyApp;
 
-typedef GxEPD2_BW<WatchyDisplay, WatchyDisplay::HEIGHT> Display;
-
 typedef struct AccelData {
   int16_t x;
   int16_t y;
   int16_t z;
 } AccelData;
 
+typedef struct WiFiStats {
+  uint16_t fastJoins;  // reusing the last access point, channel and lease
+  uint16_t fastFails;  // of those, the ones that fell back to scan and DHCP
+  uint32_t fastMillis; // how long the last fast join took
+  uint32_t slowMillis; // and the last one with a scan and DHCP
+} WiFiStats;
+
 typedef enum WakeupReason {
   WAKEUP_RESET    = 0,
   WAKEUP_CLOCK    = 1,
@@ -44,16 +49,30 @@ public:
 
   WakeupReason wakeupReason() { return wakeup_; }
 
+  // whether the local time is within the quiet hours.
+  bool quietHours();
+  // the start of the next minute and of the next hour, as unix times.
+  time_t nextMinute() { return unixtime_ - localtime_.Second + 60; }
+  time_t nextHour() {
+    return unixtime_ - localtime_.Second - localtime_.Minute * 60 + 60 * 60;
+  }
+
   void vibrate(uint8_t intervalMs = 100, uint8_t length = 20);
 
   float battVoltage();
   int battPercent();
+  // only known on V3, V2 can't tell.
+  bool usbPluggedIn();
+  // from the last button press to its frame being sent, when the press woke
+  // the watch or came during an interactive session.
+  uint32_t buttonLatencyMicros(bool interactive);
 
   // offset is the offset in seconds that the local time is from UTC.
   // e.g., EST is (-5 * 60 * 60).
   void setTimezoneOffset(time_t offset);
 
   void triggerNetworkFetch();
+  const WiFiStats &wifiStats();
   time_t lastSuccessfulNetworkFetch();
 
   uint32_t stepCounter();
@@ -74,6 +93,11 @@ protected:
 
   void reset(const tmElements_t &currentTime, WakeupReason wakeup);
 
+  // after a button wakes the watch, handles further presses from light sleep
+  // until none came for settings.interactiveTimeoutMillis.
+  static void interact(WatchyApp *app, Watchy *watchy,
+                       const WatchySettings &settings);
+
   static bool syncNTP();
   static void drawNotice(char *msg);
 
@@ -25,5 +25,14 @@ public:
   virtual AppState buttonSelect(Watchy *watchy) { return APP_ACTIVE; }
   virtual AppState buttonBack(Watchy *watchy) { return APP_EXIT; }
 
+  // the unix time the shown app next needs to be redrawn. the watch sleeps
+  // until then unless a button is pressed or a network fetch is due.
+  virtual time_t nextWakeup(Watchy *watchy) {
+    return watchy->quietHours() ? watchy->nextHour() : watchy->nextMinute();
+  }
+
+  // what is showing, for accounting. nullptr counts as "other".
+  virtual const char *name() { return nullptr; }
+
   virtual ~WatchyApp() = default;
 };
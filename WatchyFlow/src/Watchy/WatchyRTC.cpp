@@ -43,6 +43,14 @@ void WatchyRTC::clearAlarm() {
   }
 }
 
+void WatchyRTC::setAlarm(const tmElements_t &at) {
+  if (rtcType == DS3231) {
+    rtc_ds.setAlarm(DS3232RTC::ALM2_MATCH_DATE, 0, at.Minute, at.Hour, at.Day);
+  } else {
+    rtc_pcf.setAlarm(at.Minute, at.Hour, at.Day, 99);
+  }
+}
+
 void WatchyRTC::read(tmElements_t &tm) {
   if (rtcType == DS3231) {
     rtc_ds.read(tm);
@@ -24,6 +24,8 @@ public:
   void init();
   void config(String datetime); // String datetime format is YYYY:MM:DD:HH:MM:SS
   void clearAlarm();
+  // wakes the watch at the start of the minute at, instead of the next one.
+  void setAlarm(const tmElements_t &at);
   void read(tmElements_t &tm);
   void set(tmElements_t tm);
   uint8_t temperature();